@@ -0,0 +1,136 @@
+/*
+ * Throughput of 'ft::equal' and 'ft::lexicographical_compare' on large 'ft::vector's of unsigned char, short,
+ * int and long differing only in their last element, against an element by element loop and 'std::equal'.
+ * The SSE2 and AVX2 kernels of 'ft::mismatch_bytes' are also timed on their own, the AVX2 one only where
+ * the CPU has it. Prints the best of a few runs in GB/s of one range.
+ *
+ * c++ -std=c++98 -O2 -I ft_containers bench/compare.cpp -o compare && ./compare [bytes]
+ */
+
+#include <time.h>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include "vector.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/lexicographical_compare.hpp"
+#include "algorithm/mismatch_bytes.hpp"
+
+/* Runs of each measurement, of which the fastest is kept */
+static const int runs = 5;
+
+static volatile std::size_t sink;
+
+/* Monotonic clock in nanoseconds */
+static long long now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<long long>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+enum method { loop_method, std_equal_method, equal_method, lexicographical_method, sse2_method, avx2_method,
+			  methods };
+
+static const char *const method_names[ methods ] = { "loop", "std::equal", "ft::equal", "lexicographical",
+													  "sse2 kernel", "avx2 kernel" };
+
+/* Whether 'm' can run here */
+static bool available(method m)
+{
+#if FT_MISMATCH_SIMD
+	return m != avx2_method || ft::_cpu_has_avx2();
+#else
+	return m != sse2_method && m != avx2_method;
+#endif
+}
+
+template < class T >
+static void run(method m, const ft::vector<T> &a, const ft::vector<T> &b)
+{
+	const unsigned char *x = reinterpret_cast<const unsigned char *>(&a[ 0 ]);
+	const unsigned char *y = reinterpret_cast<const unsigned char *>(&b[ 0 ]);
+	const std::size_t bytes = a.size() * sizeof(T);
+	switch (m)
+	{
+		case loop_method:
+			sink = ft::equal(a.begin(), a.end(), b.begin(), std::equal_to<T>());
+			break;
+		case std_equal_method:
+			sink = std::equal(a.begin(), a.end(), b.begin());
+			break;
+		case equal_method:
+			sink = ft::equal(a.begin(), a.end(), b.begin());
+			break;
+		case lexicographical_method:
+			sink = ft::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+			break;
+#if FT_MISMATCH_SIMD
+		case sse2_method:
+			sink = ft::_mismatch_bytes_sse2(x, y, bytes);
+			break;
+		case avx2_method:
+			sink = ft::_mismatch_bytes_avx2(x, y, bytes);
+			break;
+#endif
+		default:
+			(void)x;
+			(void)y;
+			(void)bytes;
+	}
+}
+
+/* GB/s of the fastest of 'runs' comparisons of 'a' and 'b' by 'm' */
+template < class T >
+static double best_rate(method m, const ft::vector<T> &a, const ft::vector<T> &b)
+{
+	long long best = 0;
+	for (int r = 0; r < runs; ++r)
+	{
+		const long long start = now();
+		run(m, a, b);
+		const long long ns = now() - start;
+		if (r == 0 || ns < best)
+			best = ns;
+	}
+	return static_cast<double>(a.size() * sizeof(T)) / (best ? best : 1);
+}
+
+template < class T >
+static void bench(const char *name, std::size_t bytes)
+{
+	const std::size_t n = bytes / sizeof(T);
+	ft::vector<T> a(n);
+	for (std::size_t i = 0; i < n; ++i)
+		a[ i ] = static_cast<T>(i * 7);
+	ft::vector<T> b(a);
+	b.back() = static_cast<T>(b.back() + 1);
+
+	std::printf("%-14s", name);
+	for (int m = 0; m < methods; ++m)
+	{
+		if (available(method(m)))
+			std::printf("  %16.2f", best_rate(method(m), a, b));
+		else
+			std::printf("  %16s", "-");
+	}
+	std::printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+	const std::size_t bytes = argc > 1 ? std::strtoul(argv[ 1 ], NULL, 10) : 1UL << 26;
+	if (bytes < sizeof(long))
+		return 1;
+
+	std::printf("%lu bytes per range, GB/s\n%-14s", static_cast<unsigned long>(bytes), "type");
+	for (int m = 0; m < methods; ++m)
+		std::printf("  %16s", method_names[ m ]);
+	std::printf("\n");
+	bench<unsigned char>("unsigned char", bytes);
+	bench<short>("short", bytes);
+	bench<int>("int", bytes);
+	bench<long>("long", bytes);
+	return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * Lookups in an 'ft::map' far larger than the last level cache, by batches of 64 random keys: 'find_batch',
+ * which interleaves the searches of a batch so their cache misses overlap, against a loop of 'find'.
+ * The default of 2^23 keys makes a map of about half a gigabyte.
+ *
+ * c++ -std=c++98 -O2 -I ft_containers bench/find_batch.cpp -o find_batch && ./find_batch [keys [batches]]
+ */
+
+#include <time.h>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "map.hpp"
+
+typedef ft::map<unsigned long, unsigned long> map_type;
+
+static const std::size_t batch_size = 64;
+
+/* Monotonic clock in nanoseconds */
+static long long now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<long long>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+/* xorshift64, enough to scatter keys over the whole tree */
+static unsigned long next_random(unsigned long &state)
+{
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state;
+}
+
+/* Nanoseconds per key of looking up 'keys' batch by batch with 'find', summing the values into 'sum' */
+static double time_find(const map_type &m, const std::vector<unsigned long> &keys, unsigned long &sum)
+{
+	const long long start = now();
+	for (std::size_t b = 0; b < keys.size(); b += batch_size)
+	{
+		for (std::size_t i = b; i < b + batch_size; ++i)
+		{
+			const map_type::const_iterator it = m.find(keys[ i ]);
+			if (it != m.end())
+				sum += it->second;
+		}
+	}
+	return static_cast<double>(now() - start) / keys.size();
+}
+
+/* Same with 'find_batch' */
+static double time_find_batch(const map_type &m, const std::vector<unsigned long> &keys, unsigned long &sum)
+{
+	map_type::const_iterator found[ batch_size ];
+	const long long start = now();
+	for (std::size_t b = 0; b < keys.size(); b += batch_size)
+	{
+		m.find_batch(keys.begin() + b, keys.begin() + (b + batch_size), found);
+		for (std::size_t i = 0; i < batch_size; ++i)
+			if (found[ i ] != m.end())
+				sum += found[ i ]->second;
+	}
+	return static_cast<double>(now() - start) / keys.size();
+}
+
+int main(int argc, char **argv)
+{
+	const std::size_t size = argc > 1 ? std::strtoul(argv[ 1 ], NULL, 10) : 1UL << 23;
+	const std::size_t batches = argc > 2 ? std::strtoul(argv[ 2 ], NULL, 10) : 1UL << 15;
+	if (size == 0 || batches == 0)
+		return 1;
+
+	unsigned long state = 88172645463325252UL;
+	std::vector<unsigned long> inserted;
+	inserted.reserve(size);
+	map_type m;
+	while (m.size() != size)
+	{
+		const unsigned long key = next_random(state);
+		if (m.insert(ft::make_pair(key, key >> 3)).second)
+			inserted.push_back(key);
+	}
+
+	/* Three keys out of four are present */
+	std::vector<unsigned long> keys(batches * batch_size);
+	for (std::size_t i = 0; i < keys.size(); ++i)
+	{
+		const unsigned long r = next_random(state);
+		keys[ i ] = (r & 3) != 0 ? inserted[ r % size ] : r;
+	}
+
+	unsigned long sum_find = 0;
+	unsigned long sum_batch = 0;
+	/* Warm up the page tables and the upper levels of the tree */
+	time_find(m, keys, sum_find);
+	sum_find = 0;
+	const double find_ns = time_find(m, keys, sum_find);
+	const double batch_ns = time_find_batch(m, keys, sum_batch);
+
+	std::printf("%lu keys, %lu batches of %lu lookups\n", static_cast<unsigned long>(size),
+				static_cast<unsigned long>(batches), static_cast<unsigned long>(batch_size));
+	std::printf("%-12s %8.1f ns/key\n", "find", find_ns);
+	std::printf("%-12s %8.1f ns/key  %5.2fx\n", "find_batch", batch_ns, find_ns / batch_ns);
+	return sum_find == sum_batch ? 0 : 1;
+}
@@ -0,0 +1,57 @@
+/*
+ * Tail latency of push_back in both growth modes: 'ft::vector', which moves every element when it grows,
+ * against 'ft::incremental_vector', which migrates them a few at a time on later calls.
+ *
+ * c++ -std=c++98 -O2 -I ft_containers bench/incremental_vector_latency.cpp -o latency && ./latency [pushes]
+ */
+
+#include <time.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "vector.hpp"
+#include "incremental_vector.hpp"
+
+/* Monotonic clock in nanoseconds */
+static long long now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<long long>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+/* Times each of 'pushes' push_back calls on an empty 'Vector' and prints the latency percentiles */
+template < class Vector >
+static void bench(const char *name, std::size_t pushes)
+{
+	std::vector<long long> latencies;
+	latencies.reserve(pushes);
+	const std::string value(24, 'x');
+
+	Vector v;
+	for (std::size_t i = 0; i < pushes; ++i)
+	{
+		const long long start = now();
+		v.push_back(value);
+		latencies.push_back(now() - start);
+	}
+
+	std::sort(latencies.begin(), latencies.end());
+	std::printf("%-24s p50 %8lld ns  p99 %8lld ns  p99.9 %8lld ns  max %10lld ns\n", name,
+				latencies[ pushes / 2 ], latencies[ pushes * 99 / 100 ], latencies[ pushes * 999 / 1000 ],
+				latencies.back());
+}
+
+int main(int argc, char **argv)
+{
+	const std::size_t pushes = argc > 1 ? std::strtoul(argv[ 1 ], NULL, 10) : 1UL << 23;
+	if (pushes == 0)
+		return 1;
+
+	std::printf("%lu push_back of a 24 character std::string\n", static_cast<unsigned long>(pushes));
+	bench<ft::vector<std::string> >("ft::vector", pushes);
+	bench<ft::incremental_vector<std::string> >("ft::incremental_vector", pushes);
+	return 0;
+}
@@ -0,0 +1,102 @@
+/*
+ * Scaling of the 'ft::parallel' algorithms from 1 thread to all hardware threads, or to the count given, each
+ * time as a pool of 'threads - 1' workers plus the calling thread. Prints the best of a few runs in milliseconds
+ * and the speedup over 1 thread.
+ *
+ * c++ -std=c++11 -O2 -pthread -I ft_containers bench/parallel_scaling.cpp -o scaling
+ * ./scaling [elements [threads]]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <thread>
+#include "vector.hpp"
+#include "algorithm/parallel.hpp"
+
+/* Runs of each measurement, of which the fastest is kept */
+static const int runs = 3;
+
+/* Milliseconds taken by the fastest of 'runs' calls of 'measured', each after a call of 'setup' left untimed */
+template < class Setup, class Measured >
+static double best_time(Setup setup, Measured measured)
+{
+	double best = 0;
+	for (int i = 0; i < runs; ++i)
+	{
+		setup();
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		measured();
+		const double ms =
+				std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		if (i == 0 || ms < best)
+			best = ms;
+	}
+	return best;
+}
+
+enum { sort_column, for_each_column, transform_column, reduce_column, fill_column, copy_column, columns };
+
+static const char *const column_names[ columns ] = { "sort", "for_each", "transform", "reduce", "fill", "copy" };
+
+int main(int argc, char **argv)
+{
+	const std::size_t n = argc > 1 ? std::strtoul(argv[ 1 ], NULL, 10) : 1UL << 24;
+	const unsigned hardware = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+	const unsigned max_threads = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[ 2 ], NULL, 10)) : hardware;
+
+	std::mt19937_64 rng(42);
+	ft::vector<unsigned long> source(n);
+	for (std::size_t i = 0; i < n; ++i)
+		source[ i ] = rng();
+	ft::vector<unsigned long> data(n);
+	ft::vector<unsigned long> out(n);
+	volatile unsigned long sink = 0;
+
+	std::printf("%lu elements, %u hardware threads\n%8s", static_cast<unsigned long>(n), hardware, "threads");
+	for (int c = 0; c < columns; ++c)
+		std::printf("  %18s", column_names[ c ]);
+	std::printf("\n");
+
+	double single[ columns ] = { };
+	for (unsigned threads = 1; threads <= max_threads; ++threads)
+	{
+		ft::thread_pool pool(threads - 1);
+		auto nothing = [] { };
+		auto reset = [&] { ft::copy(source.begin(), source.end(), data.begin()); };
+		double ms[ columns ];
+
+		ms[ sort_column ] = best_time(reset, [&] {
+			ft::parallel::sort(data.begin(), data.end(), std::less<unsigned long>(), 0, pool);
+		});
+		ms[ for_each_column ] = best_time(reset, [&] {
+			ft::parallel::for_each(data.begin(), data.end(), [](unsigned long &x) { x = x * 3 + 1; }, 0, pool);
+		});
+		ms[ transform_column ] = best_time(nothing, [&] {
+			ft::parallel::transform(source.begin(), source.end(), out.begin(),
+									[](unsigned long x) { return x ^ (x >> 7); }, 0, pool);
+		});
+		ms[ reduce_column ] = best_time(nothing, [&] {
+			sink = ft::parallel::reduce(source.begin(), source.end(), 0UL, std::plus<unsigned long>(), 0, pool);
+		});
+		ms[ fill_column ] = best_time(nothing, [&] {
+			ft::parallel::fill(out.begin(), out.end(), 7UL, 0, pool);
+		});
+		ms[ copy_column ] = best_time(nothing, [&] {
+			ft::parallel::copy(source.begin(), source.end(), out.begin(), 0, pool);
+		});
+
+		std::printf("%8u", threads);
+		for (int c = 0; c < columns; ++c)
+		{
+			if (threads == 1)
+				single[ c ] = ms[ c ];
+			std::printf("  %9.2f ms %5.2fx", ms[ c ], single[ c ] / ms[ c ]);
+		}
+		std::printf("\n");
+	}
+	(void)sink;
+	return 0;
+}
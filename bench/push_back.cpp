@@ -0,0 +1,70 @@
+/*
+ * Throughput of push_back on 'ft::vector' against 'std::vector', for ints and for short strings, growing
+ * from empty and into reserved capacity. Prints the best of a few runs in nanoseconds per element.
+ *
+ * c++ -std=c++98 -O2 -I ft_containers bench/push_back.cpp -o push_back && ./push_back [elements]
+ */
+
+#include <time.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "vector.hpp"
+
+/* Runs of each measurement, of which the fastest is kept */
+static const int runs = 5;
+
+/* Monotonic clock in nanoseconds */
+static long long now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<long long>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+/* Nanoseconds per element of the fastest run appending 'n' copies of 'value' to a new 'Vector' */
+template < class Vector >
+static double best_time(std::size_t n, const typename Vector::value_type &value, bool reserved)
+{
+	double best = 0;
+	for (int r = 0; r < runs; ++r)
+	{
+		Vector v;
+		if (reserved)
+			v.reserve(n);
+		const long long start = now();
+		for (std::size_t i = 0; i < n; ++i)
+			v.push_back(value);
+		const double ns = static_cast<double>(now() - start) / n;
+		if (r == 0 || ns < best)
+			best = ns;
+		if (v.size() != n)
+			std::abort();
+	}
+	return best;
+}
+
+template < class T >
+static void bench(const char *name, std::size_t n, const T &value)
+{
+	for (int reserved = 0; reserved < 2; ++reserved)
+	{
+		const double ft_ns = best_time<ft::vector<T> >(n, value, reserved);
+		const double std_ns = best_time<std::vector<T> >(n, value, reserved);
+		std::printf("%-12s %-9s ft::vector %7.2f ns  std::vector %7.2f ns  ratio %5.2f\n", name,
+					reserved ? "reserved" : "growing", ft_ns, std_ns, ft_ns / std_ns);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	const std::size_t n = argc > 1 ? std::strtoul(argv[ 1 ], NULL, 10) : 1UL << 24;
+	if (n == 0)
+		return 1;
+
+	std::printf("%lu push_back per run, ratio below 1 favours ft::vector\n", static_cast<unsigned long>(n));
+	bench<int>("int", n, 42);
+	bench<std::string>("std::string", n / 4, std::string(12, 'x'));
+	return 0;
+}
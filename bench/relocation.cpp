@@ -0,0 +1,93 @@
+/*
+ * Cost of moving the elements of large POD vectors in 'reserve', 'insert' and 'erase', bytewise through
+ * memcpy/memmove as 'ft::vector' does for trivially relocatable types, against element by element as it did
+ * before. The element-wise figures come from the same PODs with 'ft::is_trivially_relocatable' specialized
+ * as false. Prints the best of a few runs in milliseconds.
+ *
+ * c++ -std=c++98 -O2 -I ft_containers bench/relocation.cpp -o relocation && ./relocation [elements]
+ */
+
+#include <time.h>
+#include <cstdio>
+#include <cstdlib>
+#include "vector.hpp"
+
+/* Runs of each measurement, of which the fastest is kept */
+static const int runs = 5;
+
+/* POD of 'Bytes' bytes, trivially relocatable unless 'Bytewise' is false */
+template < std::size_t Bytes, bool Bytewise >
+struct pod
+{
+	unsigned char bytes[ Bytes ];
+};
+
+namespace ft
+{
+	template < std::size_t Bytes >
+	struct is_trivially_relocatable<pod<Bytes, false> > : public false_type { };
+}
+
+/* Monotonic clock in nanoseconds */
+static long long now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<long long>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+enum operation { reserve_operation, insert_operation, erase_operation };
+
+/**
+ * Milliseconds of the fastest of 'runs' calls of 'op' on a vector of 'n' elements
+ * @details 'reserve' doubles the capacity, 'insert' adds 16 elements at the front with spare capacity and
+ * 'erase' removes the first 16, so that each moves all the elements once
+ */
+template < class T >
+static double best_time(std::size_t n, operation op)
+{
+	const T val = T();
+	double best = 0;
+	for (int r = 0; r < runs; ++r)
+	{
+		ft::vector<T> v(n, val);
+		if (op == insert_operation)
+			v.reserve(n + 16);
+		const long long start = now();
+		if (op == reserve_operation)
+			v.reserve(2 * n);
+		else if (op == insert_operation)
+			v.insert(v.begin(), 16, val);
+		else
+			v.erase(v.begin(), v.begin() + 16);
+		const double ms = static_cast<double>(now() - start) / 1e6;
+		if (r == 0 || ms < best)
+			best = ms;
+	}
+	return best;
+}
+
+template < std::size_t Bytes >
+static void bench(std::size_t n)
+{
+	static const char *const names[] = { "reserve", "insert", "erase" };
+	for (int op = reserve_operation; op <= erase_operation; ++op)
+	{
+		const double bytewise = best_time<pod<Bytes, true> >(n, operation(op));
+		const double element_wise = best_time<pod<Bytes, false> >(n, operation(op));
+		std::printf("%3lu byte POD %-8s bytewise %9.3f ms  element-wise %9.3f ms  %5.2fx\n",
+					static_cast<unsigned long>(Bytes), names[ op ], bytewise, element_wise, element_wise / bytewise);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	const std::size_t n = argc > 1 ? std::strtoul(argv[ 1 ], NULL, 10) : 1UL << 24;
+	if (n == 0)
+		return 1;
+
+	std::printf("%lu elements\n", static_cast<unsigned long>(n));
+	bench<sizeof(int)>(n);
+	bench<64>(n / 8);
+	return 0;
+}
@@ -0,0 +1,93 @@
+/*
+ * 'ft::sort' and 'ft::stable_sort' against 'std::sort' and 'std::stable_sort' on sorted, reversed, random and
+ * duplicate-heavy inputs of 64-bit integers. Prints the best of a few runs in milliseconds.
+ *
+ * c++ -std=c++11 -O2 -I ft_containers bench/sort.cpp -o sort && ./sort [elements]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include "vector.hpp"
+#include "algorithm/sort.hpp"
+#include "algorithm/stable_sort.hpp"
+
+/* Runs of each measurement, of which the fastest is kept */
+static const int runs = 3;
+
+/* Milliseconds taken by the fastest of 'runs' calls of 'measured', each after a call of 'setup' left untimed */
+template < class Setup, class Measured >
+static double best_time(Setup setup, Measured measured)
+{
+	double best = 0;
+	for (int i = 0; i < runs; ++i)
+	{
+		setup();
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		measured();
+		const double ms =
+				std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		if (i == 0 || ms < best)
+			best = ms;
+	}
+	return best;
+}
+
+enum { ft_sort_column, ft_stable_sort_column, std_sort_column, std_stable_sort_column, columns };
+
+static const char *const column_names[ columns ] = { "ft::sort", "ft::stable_sort", "std::sort",
+													 "std::stable_sort" };
+
+enum { sorted_pattern, reversed_pattern, random_pattern, duplicates_pattern, patterns };
+
+static const char *const pattern_names[ patterns ] = { "sorted", "reversed", "random", "duplicates" };
+
+/* Fills 'v' with the input of 'pattern', duplicates being drawn from 16 distinct values */
+static void generate(ft::vector<unsigned long> &v, int pattern)
+{
+	std::mt19937_64 rng(42);
+	const std::size_t n = v.size();
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		if (pattern == sorted_pattern)
+			v[ i ] = i;
+		else if (pattern == reversed_pattern)
+			v[ i ] = n - i;
+		else if (pattern == random_pattern)
+			v[ i ] = rng();
+		else
+			v[ i ] = rng() % 16;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	const std::size_t n = argc > 1 ? std::strtoul(argv[ 1 ], NULL, 10) : 1UL << 23;
+
+	ft::vector<unsigned long> input(n);
+	ft::vector<unsigned long> data(n);
+	std::printf("%lu elements, milliseconds\n%-10s", static_cast<unsigned long>(n), "input");
+	for (int c = 0; c < columns; ++c)
+		std::printf("  %16s", column_names[ c ]);
+	std::printf("\n");
+
+	for (int pattern = 0; pattern < patterns; ++pattern)
+	{
+		generate(input, pattern);
+		auto reset = [&] { ft::copy(input.begin(), input.end(), data.begin()); };
+		double ms[ columns ];
+
+		ms[ ft_sort_column ] = best_time(reset, [&] { ft::sort(data.begin(), data.end()); });
+		ms[ ft_stable_sort_column ] = best_time(reset, [&] { ft::stable_sort(data.begin(), data.end()); });
+		ms[ std_sort_column ] = best_time(reset, [&] { std::sort(data.begin(), data.end()); });
+		ms[ std_stable_sort_column ] = best_time(reset, [&] { std::stable_sort(data.begin(), data.end()); });
+
+		std::printf("%-10s", pattern_names[ pattern ]);
+		for (int c = 0; c < columns; ++c)
+			std::printf("  %16.2f", ms[ c ]);
+		std::printf("\n");
+	}
+	return 0;
+}
@@ -1,9 +1,31 @@
 #pragma once
 
+#include <cstring>
+#include "../iterator/iterator_traits.hpp"
+#include "../iterator/vector_iterator.hpp"
+#include "../type_traits/type_traits.hpp"
+
 namespace ft
 {
+	/**
+	 * Whether copying from 'InputIterator' to 'OutputIterator' may be done with 'memmove'
+	 * @details Holds when both are contiguous over the same trivially copyable type. The value types are
+	 * only inspected for contiguous iterators, as others such as inserters need not define a usable one.
+	 */
+	template < class InputIterator, class OutputIterator,
+			   bool = is_contiguous_iterator<InputIterator>::value && is_contiguous_iterator<OutputIterator>::value >
+	struct is_memmovable : public false_type { };
+
 	template < class InputIterator, class OutputIterator >
-	OutputIterator copy(InputIterator first, InputIterator last, OutputIterator result)
+	struct is_memmovable<InputIterator, OutputIterator, true>
+			: bool_constant<is_same<typename remove_cv<typename iterator_traits<InputIterator>::value_type>::type,
+									typename iterator_traits<OutputIterator>::value_type>::value &&
+							is_trivially_copyable<typename iterator_traits<OutputIterator>::value_type>::value>
+	{
+	};
+
+	template < class InputIterator, class OutputIterator >
+	OutputIterator _copy(InputIterator first, InputIterator last, OutputIterator result, false_type)
 	{
 		while (first != last)
 		{
@@ -13,4 +35,52 @@ namespace ft
 		}
 		return result;
 	}
+
+	template < class InputIterator, class OutputIterator >
+	OutputIterator _copy(InputIterator first, InputIterator last, OutputIterator result, true_type)
+	{
+		typedef typename iterator_traits<OutputIterator>::value_type value_type;
+		const typename iterator_traits<InputIterator>::difference_type n = last - first;
+		if (n > 0)
+			std::memmove(static_cast<void *>(ft::to_address(result)),
+						 static_cast<const void *>(ft::to_address(first)), n * sizeof(value_type));
+		return result + n;
+	}
+
+	/* Copy, a single 'memmove' for contiguous ranges of trivially copyable types */
+	template < class InputIterator, class OutputIterator >
+	OutputIterator copy(InputIterator first, InputIterator last, OutputIterator result)
+	{
+		return ft::_copy(first, last, result, is_memmovable<InputIterator, OutputIterator>());
+	}
+
+	template < class BidirectionalIterator1, class BidirectionalIterator2 >
+	BidirectionalIterator2 _copy_backward(BidirectionalIterator1 first, BidirectionalIterator1 last,
+										  BidirectionalIterator2 d_last, false_type)
+	{
+		while (first != last)
+			*--d_last = *--last;
+		return d_last;
+	}
+
+	template < class BidirectionalIterator1, class BidirectionalIterator2 >
+	BidirectionalIterator2 _copy_backward(BidirectionalIterator1 first, BidirectionalIterator1 last,
+										  BidirectionalIterator2 d_last, true_type)
+	{
+		typedef typename iterator_traits<BidirectionalIterator2>::value_type value_type;
+		const typename iterator_traits<BidirectionalIterator1>::difference_type n = last - first;
+		if (n > 0)
+			std::memmove(static_cast<void *>(ft::to_address(d_last - n)),
+						 static_cast<const void *>(ft::to_address(first)), n * sizeof(value_type));
+		return d_last - n;
+	}
+
+	/* Copy Backward, copies [first, last) to the range ending at 'd_last', starting with the last element */
+	template < class BidirectionalIterator1, class BidirectionalIterator2 >
+	BidirectionalIterator2 copy_backward(BidirectionalIterator1 first, BidirectionalIterator1 last,
+										 BidirectionalIterator2 d_last)
+	{
+		return ft::_copy_backward(first, last, d_last,
+								  is_memmovable<BidirectionalIterator1, BidirectionalIterator2>());
+	}
 } // namespace ft
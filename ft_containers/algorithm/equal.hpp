@@ -1,10 +1,12 @@
 #pragma once
 
+#include <cstring>
+#include "mismatch_bytes.hpp"
+
 namespace ft
 {
-	/* Equal */
 	template < class InputIterator1, class InputIterator2 >
-	bool equal(InputIterator1 first_1, InputIterator1 last_1, InputIterator2 first_2)
+	bool _equal(InputIterator1 first_1, InputIterator1 last_1, InputIterator2 first_2, false_type)
 	{
 		while (first_1 != last_1)
 		{
@@ -16,6 +18,23 @@ namespace ft
 		return true;
 	}
 
+	/* The C library's 'memcmp' is already vectorized and picks its kernel for the running CPU */
+	template < class InputIterator1, class InputIterator2 >
+	bool _equal(InputIterator1 first_1, InputIterator1 last_1, InputIterator2 first_2, true_type)
+	{
+		typedef typename iterator_traits<InputIterator1>::value_type value_type;
+		const typename iterator_traits<InputIterator1>::difference_type n = last_1 - first_1;
+		return n <= 0 || std::memcmp(static_cast<const void *>(ft::to_address(first_1)),
+									 static_cast<const void *>(ft::to_address(first_2)), n * sizeof(value_type)) == 0;
+	}
+
+	/* Equal, a single 'memcmp' for contiguous ranges of integers or pointers */
+	template < class InputIterator1, class InputIterator2 >
+	bool equal(InputIterator1 first_1, InputIterator1 last_1, InputIterator2 first_2)
+	{
+		return ft::_equal(first_1, last_1, first_2, is_bitwise_comparable<InputIterator1, InputIterator2>());
+	}
+
 	/* Predicate */
 	template < class InputIterator1, class InputIterator2, class BinaryPredicate >
 	bool equal(InputIterator1 first_1, InputIterator1 last_1, InputIterator2 first_2, BinaryPredicate pred)
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstring>
+#include "../iterator/iterator_traits.hpp"
+#include "../iterator/vector_iterator.hpp"
+#include "../type_traits/type_traits.hpp"
+
+namespace ft
+{
+	/**
+	 * Whether filling through 'ForwardIterator' may be done with 'memset'
+	 * @details Holds for contiguous ranges of integral types, whose only all-zero-bytes value is zero.
+	 * Floating point types are left out, as negative zero compares equal to zero.
+	 */
+	template < class ForwardIterator, bool = is_contiguous_iterator<ForwardIterator>::value >
+	struct is_memsettable : public false_type { };
+
+	template < class ForwardIterator >
+	struct is_memsettable<ForwardIterator, true>
+			: bool_constant<is_integral<typename iterator_traits<ForwardIterator>::value_type>::value &&
+							is_same<typename remove_cv<typename iterator_traits<ForwardIterator>::value_type>::type,
+									typename iterator_traits<ForwardIterator>::value_type>::value>
+	{
+	};
+
+	template < class ForwardIterator, class T >
+	void _fill(ForwardIterator first, ForwardIterator last, const T &val, false_type)
+	{
+		for (; first != last; ++first)
+			*first = val;
+	}
+
+	/* Bytes are set to any value, wider integers only to zero */
+	template < class ForwardIterator, class T >
+	void _fill(ForwardIterator first, ForwardIterator last, const T &val, true_type)
+	{
+		typedef typename iterator_traits<ForwardIterator>::value_type value_type;
+		const value_type v = val;
+		if (sizeof(value_type) != 1 && v != 0)
+		{
+			ft::_fill(first, last, v, false_type());
+			return;
+		}
+		const typename iterator_traits<ForwardIterator>::difference_type n = last - first;
+		if (n > 0)
+			std::memset(static_cast<void *>(ft::to_address(first)), static_cast<unsigned char>(v),
+						n * sizeof(value_type));
+	}
+
+	/* Fill, a single 'memset' for contiguous ranges of bytes or of zeroed integers */
+	template < class ForwardIterator, class T >
+	void fill(ForwardIterator first, ForwardIterator last, const T &val)
+	{
+		ft::_fill(first, last, val, is_memsettable<ForwardIterator>());
+	}
+} // namespace ft
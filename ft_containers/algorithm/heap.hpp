@@ -0,0 +1,87 @@
+#pragma once
+
+#include <functional>
+#include "../iterator/iterator_traits.hpp"
+#include "../utility/move.hpp"
+
+namespace ft
+{
+	/**
+	 * Places 'val' in the hole at 'hole' of the max-heap [first, first + len), sifting it down
+	 * @details The hole first sinks to a leaf along the larger children, then 'val' climbs back up, which
+	 * needs about half the comparisons of stopping at the right level on the way down
+	 */
+	template < class RandomAccessIterator, class Distance, class T, class Compare >
+	void _sift_down(RandomAccessIterator first, Distance hole, Distance len, T &val, Compare &comp)
+	{
+		const Distance top = hole;
+		Distance child = hole;
+		while (child < (len - 1) / 2)
+		{
+			child = 2 * (child + 1);
+			if (comp(*(first + child), *(first + (child - 1))))
+				--child;
+			*(first + hole) = ft::move(*(first + child));
+			hole = child;
+		}
+		if ((len & 1) == 0 && child == (len - 2) / 2)
+		{
+			child = 2 * child + 1;
+			*(first + hole) = ft::move(*(first + child));
+			hole = child;
+		}
+		Distance parent = (hole - 1) / 2;
+		while (hole > top && comp(*(first + parent), val))
+		{
+			*(first + hole) = ft::move(*(first + parent));
+			hole = parent;
+			parent = (hole - 1) / 2;
+		}
+		*(first + hole) = ft::move(val);
+	}
+
+	/* Make Heap, rearranges [first, last) into a max-heap */
+	template < class RandomAccessIterator, class Compare >
+	void make_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+		const difference_type len = last - first;
+		if (len < 2)
+			return;
+		for (difference_type parent = (len - 2) / 2;; --parent)
+		{
+			value_type val(ft::move(*(first + parent)));
+			ft::_sift_down(first, parent, len, val, comp);
+			if (parent == 0)
+				return;
+		}
+	}
+
+	template < class RandomAccessIterator >
+	void make_heap(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		ft::make_heap(first, last, std::less<typename iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	/* Sort Heap, turns the max-heap [first, last) into an ascending range */
+	template < class RandomAccessIterator, class Compare >
+	void sort_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+		for (difference_type len = last - first; len > 1; --len)
+		{
+			--last;
+			value_type val(ft::move(*last));
+			*last = ft::move(*first);
+			ft::_sift_down(first, difference_type(0), len - 1, val, comp);
+		}
+	}
+
+	template < class RandomAccessIterator >
+	void sort_heap(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		ft::sort_heap(first, last, std::less<typename iterator_traits<RandomAccessIterator>::value_type>());
+	}
+} // namespace ft
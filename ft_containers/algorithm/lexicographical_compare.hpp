@@ -1,10 +1,13 @@
 #pragma once
 
+#include <cstring>
+#include "mismatch_bytes.hpp"
+
 namespace ft
 {
 	template < class InputIterator1, class InputIterator2 >
-	bool lexicographical_compare(
-			InputIterator1 first_1, InputIterator1 last_1, InputIterator2 first_2, InputIterator2 last_2
+	bool _lexicographical_compare(
+			InputIterator1 first_1, InputIterator1 last_1, InputIterator2 first_2, InputIterator2 last_2, false_type
 	)
 	{
 		while (first_1 != last_1)
@@ -19,4 +22,41 @@ namespace ft
 		return (first_2 != last_2);
 	}
 
+	/**
+	 * Finds the first mismatching byte of the common prefix, then compares the elements holding it
+	 * @details Unsigned bytes order like their values, so they are compared by 'memcmp' directly
+	 */
+	template < class InputIterator1, class InputIterator2 >
+	bool _lexicographical_compare(
+			InputIterator1 first_1, InputIterator1 last_1, InputIterator2 first_2, InputIterator2 last_2, true_type
+	)
+	{
+		typedef typename remove_cv<typename iterator_traits<InputIterator1>::value_type>::type value_type;
+		const typename iterator_traits<InputIterator1>::difference_type n_1 = last_1 - first_1;
+		const typename iterator_traits<InputIterator2>::difference_type n_2 = last_2 - first_2;
+		const std::size_t n = static_cast<std::size_t>(n_1 < n_2 ? n_1 : n_2);
+		const value_type *a = ft::to_address(first_1);
+		const value_type *b = ft::to_address(first_2);
+		if (n == 0)
+			return n_1 < n_2;
+		if (is_same<value_type, unsigned char>::value || is_same<value_type, bool>::value ||
+			(is_same<value_type, char>::value && static_cast<char>(-1) > 0))
+		{
+			const int cmp = std::memcmp(static_cast<const void *>(a), static_cast<const void *>(b), n);
+			return cmp != 0 ? cmp < 0 : n_1 < n_2;
+		}
+		const std::size_t i = ft::mismatch_bytes(a, b, n * sizeof(value_type)) / sizeof(value_type);
+		return i != n ? a[ i ] < b[ i ] : n_1 < n_2;
+	}
+
+	/* Lexicographical Compare, compares contiguous ranges of integers or pointers bytewise with SIMD */
+	template < class InputIterator1, class InputIterator2 >
+	bool lexicographical_compare(
+			InputIterator1 first_1, InputIterator1 last_1, InputIterator2 first_2, InputIterator2 last_2
+	)
+	{
+		return ft::_lexicographical_compare(first_1, last_1, first_2, last_2,
+											is_bitwise_comparable<InputIterator1, InputIterator2>());
+	}
+
 } // namespace ft
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <functional>
+
+namespace ft
+{
+	template < class T, class Compare >
+	const T &max(const T &a, const T &b, Compare comp)
+	{
+		return comp(a, b) ? b : a;
+	}
+
+	template < class T >
+	const T &max(const T &a, const T &b)
+	{
+		return ft::max<T, std::less<T> >(a, b, std::less<T>());
+	}
+} // namespace ft
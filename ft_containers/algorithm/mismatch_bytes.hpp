@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include "../iterator/iterator_traits.hpp"
+#include "../iterator/vector_iterator.hpp"
+#include "../type_traits/type_traits.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+# define FT_MISMATCH_SIMD 1
+# include <immintrin.h>
+#else
+# define FT_MISMATCH_SIMD 0
+#endif
+
+namespace ft
+{
+	/**
+	 * Whether elements of two contiguous ranges compare equal exactly when their bytes do
+	 * @details Holds for the same integral or pointer type on both sides. Floating point types are left
+	 * out, as NaN differs from itself and negative zero equals zero.
+	 */
+	template < class InputIterator1, class InputIterator2,
+			   bool = is_contiguous_iterator<InputIterator1>::value && is_contiguous_iterator<InputIterator2>::value >
+	struct is_bitwise_comparable : public false_type { };
+
+	template < class InputIterator1, class InputIterator2 >
+	struct is_bitwise_comparable<InputIterator1, InputIterator2, true>
+			: bool_constant<is_same<typename remove_cv<typename iterator_traits<InputIterator1>::value_type>::type,
+									typename remove_cv<typename iterator_traits<InputIterator2>::value_type>::type>::value
+							&& (is_integral<typename iterator_traits<InputIterator1>::value_type>::value ||
+								is_pointer<typename iterator_traits<InputIterator1>::value_type>::value)>
+	{
+	};
+
+	inline std::size_t _mismatch_bytes_scalar(const unsigned char *a, const unsigned char *b, std::size_t n)
+	{
+		std::size_t i = 0;
+		while (i < n && a[ i ] == b[ i ])
+			++i;
+		return i;
+	}
+
+#if FT_MISMATCH_SIMD
+	/* Compares 16 bytes per step, the lowest bit of the inverted equality mask is the first mismatch */
+	inline std::size_t _mismatch_bytes_sse2(const unsigned char *a, const unsigned char *b, std::size_t n)
+	{
+		std::size_t i = 0;
+		for (; i + 16 <= n; i += 16)
+		{
+			const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+			const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+			const unsigned int mask = ~static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y))) & 0xffffu;
+			if (mask != 0)
+				return i + __builtin_ctz(mask);
+		}
+		return i + _mismatch_bytes_scalar(a + i, b + i, n - i);
+	}
+
+	/* Same over 32 bytes, compiled for AVX2 whatever the target and only called where the CPU has it */
+	__attribute__((target("avx2")))
+	inline std::size_t _mismatch_bytes_avx2(const unsigned char *a, const unsigned char *b, std::size_t n)
+	{
+		std::size_t i = 0;
+		for (; i + 32 <= n; i += 32)
+		{
+			const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+			const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+			const unsigned int mask = ~static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+			if (mask != 0)
+				return i + __builtin_ctz(mask);
+		}
+		return i + _mismatch_bytes_sse2(a + i, b + i, n - i);
+	}
+
+	inline bool _cpu_has_avx2()
+	{
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2");
+	}
+#endif
+
+	/**
+	 * Finds the first differing byte of two buffers of 'n' bytes
+	 * @details Uses AVX2 when the CPU supports it, detected once, otherwise SSE2, which every x86-64 CPU
+	 * has, and a plain loop on other architectures
+	 * @return Offset of the first differing byte, 'n' if the buffers are equal
+	 */
+	inline std::size_t mismatch_bytes(const void *a, const void *b, std::size_t n)
+	{
+		const unsigned char *x = static_cast<const unsigned char *>(a);
+		const unsigned char *y = static_cast<const unsigned char *>(b);
+#if FT_MISMATCH_SIMD
+		static const bool avx2 = _cpu_has_avx2();
+		return avx2 ? _mismatch_bytes_avx2(x, y, n) : _mismatch_bytes_sse2(x, y, n);
+#else
+		return _mismatch_bytes_scalar(x, y, n);
+#endif
+	}
+} // namespace ft
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "copy.hpp"
+#include "../utility/move.hpp"
+
+namespace ft
+{
+	template < class InputIterator, class OutputIterator >
+	OutputIterator _move(InputIterator first, InputIterator last, OutputIterator result, false_type)
+	{
+		while (first != last)
+		{
+			*result = ft::move(*first);
+			++result;
+			++first;
+		}
+		return result;
+	}
+
+	template < class InputIterator, class OutputIterator >
+	OutputIterator _move(InputIterator first, InputIterator last, OutputIterator result, true_type)
+	{
+		return ft::_copy(first, last, result, true_type());
+	}
+
+	/* Move, moving a trivially copyable element is copying it, so contiguous ranges take a single 'memmove' */
+	template < class InputIterator, class OutputIterator >
+	OutputIterator move(InputIterator first, InputIterator last, OutputIterator result)
+	{
+		return ft::_move(first, last, result, is_memmovable<InputIterator, OutputIterator>());
+	}
+
+	template < class BidirectionalIterator1, class BidirectionalIterator2 >
+	BidirectionalIterator2 _move_backward(BidirectionalIterator1 first, BidirectionalIterator1 last,
+										  BidirectionalIterator2 d_last, false_type)
+	{
+		while (first != last)
+			*--d_last = ft::move(*--last);
+		return d_last;
+	}
+
+	template < class BidirectionalIterator1, class BidirectionalIterator2 >
+	BidirectionalIterator2 _move_backward(BidirectionalIterator1 first, BidirectionalIterator1 last,
+										  BidirectionalIterator2 d_last, true_type)
+	{
+		return ft::_copy_backward(first, last, d_last, true_type());
+	}
+
+	/* Move Backward, moves [first, last) to the range ending at 'd_last', starting with the last element */
+	template < class BidirectionalIterator1, class BidirectionalIterator2 >
+	BidirectionalIterator2 move_backward(BidirectionalIterator1 first, BidirectionalIterator1 last,
+										 BidirectionalIterator2 d_last)
+	{
+		return ft::_move_backward(first, last, d_last,
+								  is_memmovable<BidirectionalIterator1, BidirectionalIterator2>());
+	}
+} // namespace ft
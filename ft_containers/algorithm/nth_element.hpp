@@ -0,0 +1,64 @@
+#pragma once
+
+#include <functional>
+#include "sort.hpp"
+#include "partial_sort.hpp"
+
+namespace ft
+{
+	/**
+	 * Nth Element, puts at 'nth' the element a sort would, with no greater one before and no smaller one after
+	 * @details Introselect over the partitioning of 'ft::sort', recursing only into the side holding 'nth'.
+	 * Runs of equal elements are settled at once as in the sort, and too many unbalanced partitions fall
+	 * back to 'ft::partial_sort', bounding the worst case to O(n log n).
+	 */
+	template < class RandomAccessIterator, class Compare >
+	void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+		if (!(nth < last))
+			return;
+		const RandomAccessIterator begin = first;
+		int bad_allowed = ft::_log2(last - first);
+		while (last - first >= _sort_insertion_threshold)
+		{
+			const difference_type size = last - first;
+			ft::_choose_pivot(first, last, comp);
+			if (first != begin && !comp(*(first - 1), *first))
+			{
+				const RandomAccessIterator pivot_pos = ft::_partition_left(first, last, comp);
+				if (!(pivot_pos < nth))
+					return;
+				first = pivot_pos + 1;
+				continue;
+			}
+
+			const RandomAccessIterator pivot_pos =
+					ft::_partition_right(first, last, comp, _is_branchless_comparable<value_type, Compare>()).first;
+			if (pivot_pos == nth)
+				return;
+			if (pivot_pos - first < size / 8 || last - (pivot_pos + 1) < size / 8)
+			{
+				if (--bad_allowed == 0)
+				{
+					ft::partial_sort(first, nth + 1, last, comp);
+					return;
+				}
+				ft::_shuffle_ends(first, pivot_pos, pivot_pos - first);
+				ft::_shuffle_ends(pivot_pos + 1, last, last - (pivot_pos + 1));
+			}
+			if (nth < pivot_pos)
+				last = pivot_pos;
+			else
+				first = pivot_pos + 1;
+		}
+		ft::_insertion_sort(first, last, comp);
+	}
+
+	template < class RandomAccessIterator >
+	void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last)
+	{
+		ft::nth_element(first, nth, last, std::less<typename iterator_traits<RandomAccessIterator>::value_type>());
+	}
+} // namespace ft
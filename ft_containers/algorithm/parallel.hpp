@@ -0,0 +1,314 @@
+#pragma once
+
+#include "../utility/compiler.hpp"
+
+#if FT_CXX11
+
+#include <cstddef>
+#include <new>
+#include <functional>
+#include "copy.hpp"
+#include "fill.hpp"
+#include "max.hpp"
+#include "move.hpp"
+#include "sort.hpp"
+#include "stable_sort.hpp"
+#include "../iterator/iterator_traits.hpp"
+#include "../utility/move.hpp"
+#include "../utility/thread_pool.hpp"
+#include "../vector.hpp"
+
+namespace ft
+{
+	/**
+	 * Parallel versions of the bulk algorithms over random access ranges (C++11 only)
+	 * @details Ranges are cut into chunks of 'grain' elements run as tasks of a 'thread_pool', the shared one
+	 * unless another is given, with the calling thread taking part. A grain of 0 picks a few chunks per
+	 * thread, so that threads finishing early steal the remaining ones, but no smaller than a few thousand
+	 * elements, below which forking costs more than it saves. Functions passed in are called concurrently.
+	 */
+	namespace parallel
+	{
+		/* Parallel Tuning */
+		enum
+		{
+			/* Smallest chunk chosen for the element-wise algorithms when the grain is left to them */
+			_min_grain = 4096,
+			/* Chunks per thread chosen for the element-wise algorithms */
+			_chunks_per_thread = 4,
+			/* Smallest run chosen for sort, which sorts one run per thread before merging them */
+			_sort_min_grain = 16384
+		};
+
+		inline std::size_t _chunk_count(std::size_t n, std::size_t grain, const thread_pool &pool)
+		{
+			if (grain == 0)
+				grain = ft::max<std::size_t>(n / (pool.concurrency() * _chunks_per_thread), _min_grain);
+			return (n + grain - 1) / grain;
+		}
+
+		/* Calls 'body(index)' for each index of [0, count) as tasks of 'pool', the first on the calling thread */
+		template < class Body >
+		void _run_tasks(std::size_t count, thread_pool &pool, Body &body)
+		{
+			if (count == 1)
+			{
+				body(0);
+				return;
+			}
+			task_group group(pool);
+			for (std::size_t i = 1; i < count; ++i)
+				group.run([&body, i] { body(i); });
+			body(0);
+			group.wait();
+		}
+
+		/* Calls 'body(begin, end, index)' for each of 'chunks' equal chunks of [0, n) */
+		template < class Body >
+		void _for_chunks(std::size_t n, std::size_t chunks, thread_pool &pool, Body body)
+		{
+			if (n == 0)
+				return;
+			auto task = [&body, n, chunks](std::size_t i) { body(i * n / chunks, (i + 1) * n / chunks, i); };
+			ft::parallel::_run_tasks(chunks, pool, task);
+		}
+
+		/* For Each, calls a copy of 'f' per chunk on each element of the chunk */
+		template < class RandomAccessIterator, class Function >
+		void for_each(RandomAccessIterator first, RandomAccessIterator last, Function f, std::size_t grain = 0,
+					  thread_pool &pool = thread_pool::instance())
+		{
+			const std::size_t n = static_cast<std::size_t>(last - first);
+			ft::parallel::_for_chunks(n, ft::parallel::_chunk_count(n, grain, pool), pool,
+									  [first, &f](std::size_t begin, std::size_t end, std::size_t) {
+										  Function chunk_f(f);
+										  for (RandomAccessIterator it = first + begin; it != first + end; ++it)
+											  chunk_f(*it);
+									  });
+		}
+
+		/* Transform, stores 'op' of each element of [first, last) to the range at 'result' */
+		template < class RandomAccessIterator1, class RandomAccessIterator2, class UnaryOperation >
+		RandomAccessIterator2 transform(RandomAccessIterator1 first, RandomAccessIterator1 last,
+										RandomAccessIterator2 result, UnaryOperation op, std::size_t grain = 0,
+										thread_pool &pool = thread_pool::instance())
+		{
+			const std::size_t n = static_cast<std::size_t>(last - first);
+			ft::parallel::_for_chunks(n, ft::parallel::_chunk_count(n, grain, pool), pool,
+									  [first, result, &op](std::size_t begin, std::size_t end, std::size_t) {
+										  UnaryOperation chunk_op(op);
+										  for (std::size_t i = begin; i != end; ++i)
+											  result[ i ] = chunk_op(first[ i ]);
+									  });
+			return result + n;
+		}
+
+		/**
+		 * Reduce, folds [first, last) into 'init' with 'op'
+		 * @details Each chunk is folded on its own, then the results are folded in order, so 'op' must be
+		 * associative, but need not be commutative
+		 */
+		template < class RandomAccessIterator, class T, class BinaryOperation >
+		T reduce(RandomAccessIterator first, RandomAccessIterator last, T init, BinaryOperation op,
+				 std::size_t grain = 0, thread_pool &pool = thread_pool::instance())
+		{
+			const std::size_t n = static_cast<std::size_t>(last - first);
+			if (n == 0)
+				return init;
+			const std::size_t chunks = ft::parallel::_chunk_count(n, grain, pool);
+			ft::vector<T> partials(chunks, init);
+			ft::parallel::_for_chunks(n, chunks, pool,
+									  [first, &op, &partials](std::size_t begin, std::size_t end, std::size_t index) {
+										  BinaryOperation chunk_op(op);
+										  T acc(first[ begin ]);
+										  for (std::size_t i = begin + 1; i != end; ++i)
+											  acc = chunk_op(ft::move(acc), first[ i ]);
+										  partials[ index ] = ft::move(acc);
+									  });
+			for (std::size_t i = 0; i < chunks; ++i)
+				init = op(ft::move(init), partials[ i ]);
+			return init;
+		}
+
+		template < class RandomAccessIterator, class T >
+		T reduce(RandomAccessIterator first, RandomAccessIterator last, T init)
+		{
+			return ft::parallel::reduce(first, last, init, std::plus<T>());
+		}
+
+		/* Fill, each chunk takes the 'memset' path of 'ft::fill' where it applies */
+		template < class RandomAccessIterator, class T >
+		void fill(RandomAccessIterator first, RandomAccessIterator last, const T &val, std::size_t grain = 0,
+				  thread_pool &pool = thread_pool::instance())
+		{
+			const std::size_t n = static_cast<std::size_t>(last - first);
+			ft::parallel::_for_chunks(n, ft::parallel::_chunk_count(n, grain, pool), pool,
+									  [first, &val](std::size_t begin, std::size_t end, std::size_t) {
+										  ft::fill(first + begin, first + end, val);
+									  });
+		}
+
+		/* Copy, each chunk takes the 'memmove' path of 'ft::copy' where it applies */
+		template < class RandomAccessIterator1, class RandomAccessIterator2 >
+		RandomAccessIterator2 copy(RandomAccessIterator1 first, RandomAccessIterator1 last,
+								   RandomAccessIterator2 result, std::size_t grain = 0,
+								   thread_pool &pool = thread_pool::instance())
+		{
+			const std::size_t n = static_cast<std::size_t>(last - first);
+			ft::parallel::_for_chunks(n, ft::parallel::_chunk_count(n, grain, pool), pool,
+									  [first, result](std::size_t begin, std::size_t end, std::size_t) {
+										  ft::copy(first + begin, first + end, result + begin);
+									  });
+			return result + n;
+		}
+
+		/* Merges the sorted runs [first_1, last_1) and [first_2, last_2), moving their elements to 'result' */
+		template < class Source, class Destination, class Compare >
+		void _merge_move(Source first_1, Source last_1, Source first_2, Source last_2, Destination result,
+						 Compare &comp)
+		{
+			for (; first_1 != last_1 && first_2 != last_2; ++result)
+			{
+				if (comp(*first_2, *first_1))
+					*result = ft::move(*first_2++);
+				else
+					*result = ft::move(*first_1++);
+			}
+			result = ft::move(first_1, last_1, result);
+			ft::move(first_2, last_2, result);
+		}
+
+		/**
+		 * Merges the sorted runs [first, middle) and [middle, last) to 'result', in pieces of about 'grain'
+		 * elements run as tasks of 'group'
+		 * @details The longer run is cut at even intervals, and the other one where the element at each cut
+		 * goes, so that every piece is a merge of its own. All cuts are found before the first piece starts
+		 * moving elements out of the runs.
+		 */
+		template < class Source, class Destination, class Compare >
+		void _merge(Source first, Source middle, Source last, Destination result, Compare &comp, std::size_t grain,
+					task_group &group)
+		{
+			const std::size_t len_1 = static_cast<std::size_t>(middle - first);
+			const std::size_t len_2 = static_cast<std::size_t>(last - middle);
+			const std::size_t pieces = ft::max<std::size_t>((len_1 + len_2) / grain, 1);
+			ft::vector<Source> cuts_1(1, first);
+			ft::vector<Source> cuts_2(1, middle);
+			for (std::size_t i = 1; i < pieces; ++i)
+			{
+				if (len_1 >= len_2)
+				{
+					cuts_1.push_back(first + i * len_1 / pieces);
+					cuts_2.push_back(ft::_lower_bound(middle, last, *cuts_1.back(), comp));
+				}
+				else
+				{
+					cuts_2.push_back(middle + i * len_2 / pieces);
+					cuts_1.push_back(ft::_upper_bound(first, middle, *cuts_2.back(), comp));
+				}
+			}
+			cuts_1.push_back(middle);
+			cuts_2.push_back(last);
+			for (std::size_t i = 0; i < pieces; ++i)
+			{
+				const Source begin_1 = cuts_1[ i ];
+				const Source end_1 = cuts_1[ i + 1 ];
+				const Source begin_2 = cuts_2[ i ];
+				const Source end_2 = cuts_2[ i + 1 ];
+				const Destination out = result + ((begin_1 - first) + (begin_2 - middle));
+				group.run([begin_1, end_1, begin_2, end_2, out, &comp] {
+					ft::parallel::_merge_move(begin_1, end_1, begin_2, end_2, out, comp);
+				});
+			}
+		}
+
+		/**
+		 * Sort, sorts one run of 'grain' elements per task with 'ft::sort', then merges runs pairwise
+		 * @details Each round merges every pair of runs between the range and a buffer of the same length, each
+		 * merge itself cut into pieces, so that all threads take part up to the last round. Not stable. If
+		 * 'comp' throws, the elements are left in the range with unspecified values. Lacking memory for the
+		 * buffer, falls back to 'ft::sort'.
+		 */
+		template < class RandomAccessIterator, class Compare >
+		void sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp, std::size_t grain = 0,
+				  thread_pool &pool = thread_pool::instance())
+		{
+			typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+			const std::size_t n = static_cast<std::size_t>(last - first);
+			if (grain == 0)
+				grain = ft::max<std::size_t>(n / pool.concurrency(), _sort_min_grain);
+			const std::size_t runs = (n + grain - 1) / grain;
+			value_type *buffer = NULL;
+			if (runs > 1)
+				buffer = static_cast<value_type *>(::operator new(n * sizeof(value_type), std::nothrow));
+			if (buffer == NULL)
+			{
+				ft::sort(first, last, comp);
+				return;
+			}
+
+			ft::vector<std::size_t> bounds;
+			for (std::size_t i = 0; i <= runs; ++i)
+				bounds.push_back(i * n / runs);
+			ft::vector<char> constructed(runs, 0);
+			try
+			{
+				ft::parallel::_for_chunks(n, runs, pool,
+										  [first, buffer, comp, &constructed](std::size_t begin, std::size_t end,
+																			  std::size_t index) {
+											  Compare run_comp(comp);
+											  ft::sort(first + begin, first + end, run_comp);
+											  ft::_move_to_buffer(first + begin, first + end, buffer + begin);
+											  constructed[ index ] = 1;
+										  });
+
+				bool in_buffer = true;
+				while (bounds.size() > 2)
+				{
+					ft::vector<std::size_t> merged;
+					task_group group(pool);
+					for (std::size_t i = 0; i + 1 < bounds.size(); i += 2)
+					{
+						const std::size_t begin = bounds[ i ];
+						const std::size_t middle = bounds[ i + 1 ];
+						const std::size_t end = i + 2 < bounds.size() ? bounds[ i + 2 ] : middle;
+						merged.push_back(begin);
+						if (in_buffer)
+							ft::parallel::_merge(buffer + begin, buffer + middle, buffer + end, first + begin, comp,
+												 grain, group);
+						else
+							ft::parallel::_merge(first + begin, first + middle, first + end, buffer + begin, comp,
+												 grain, group);
+					}
+					merged.push_back(n);
+					group.wait();
+					bounds.swap(merged);
+					in_buffer = !in_buffer;
+				}
+				if (in_buffer)
+					ft::parallel::_for_chunks(n, runs, pool,
+											  [first, buffer](std::size_t begin, std::size_t end, std::size_t) {
+												  ft::move(buffer + begin, buffer + end, first + begin);
+											  });
+			}
+			catch (...)
+			{
+				for (std::size_t i = 0; i < runs; ++i)
+					if (constructed[ i ])
+						ft::_destroy_buffer(buffer + i * n / runs, buffer + (i + 1) * n / runs);
+				::operator delete(buffer);
+				throw;
+			}
+			ft::_destroy_buffer(buffer, buffer + n);
+			::operator delete(buffer);
+		}
+
+		template < class RandomAccessIterator >
+		void sort(RandomAccessIterator first, RandomAccessIterator last)
+		{
+			ft::parallel::sort(first, last, std::less<typename iterator_traits<RandomAccessIterator>::value_type>());
+		}
+	} // namespace parallel
+} // namespace ft
+
+#endif
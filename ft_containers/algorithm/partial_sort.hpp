@@ -0,0 +1,41 @@
+#pragma once
+
+#include <functional>
+#include "heap.hpp"
+#include "../iterator/iterator_traits.hpp"
+#include "../utility/move.hpp"
+
+namespace ft
+{
+	/**
+	 * Partial Sort, sorts the smallest 'middle - first' elements of [first, last) into [first, middle)
+	 * @details Keeps them in a max-heap, replacing its top by each smaller element of the rest, in
+	 * O(n log k). The order of the remaining elements is unspecified.
+	 */
+	template < class RandomAccessIterator, class Compare >
+	void partial_sort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
+					  Compare comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+		const difference_type len = middle - first;
+		if (len == 0)
+			return;
+		ft::make_heap(first, middle, comp);
+		for (RandomAccessIterator i = middle; i < last; ++i)
+		{
+			if (!comp(*i, *first))
+				continue;
+			value_type val(ft::move(*i));
+			*i = ft::move(*first);
+			ft::_sift_down(first, difference_type(0), len, val, comp);
+		}
+		ft::sort_heap(first, middle, comp);
+	}
+
+	template < class RandomAccessIterator >
+	void partial_sort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+	{
+		ft::partial_sort(first, middle, last, std::less<typename iterator_traits<RandomAccessIterator>::value_type>());
+	}
+} // namespace ft
@@ -0,0 +1,294 @@
+#pragma once
+
+#include <cstddef>
+#include <climits>
+#include <new>
+#include "copy.hpp"
+#include "move.hpp"
+#include "sort.hpp"
+#include "stable_sort.hpp"
+#include "../iterator/iterator_traits.hpp"
+#include "../type_traits/type_traits.hpp"
+#include "../utility/move.hpp"
+#include "../utility/pair.hpp"
+
+namespace ft
+{
+	/* Radix Sort Tuning */
+	enum
+	{
+		/* Below this length, the histograms cost more than comparing, so radix sort falls back to stable sort */
+		_radix_sort_threshold = 256,
+		/* Buckets shorter than this are insertion sorted */
+		_radix_sort_insertion_threshold = 32,
+		/* Buckets larger than this many bytes are split on their most significant byte first, as scattering
+		   a range larger than the cache to 256 places at once misses on nearly every write */
+		_radix_sort_lsd_bytes = 16384
+	};
+
+	/**
+	 * Default key of radix sort, the element itself for integral types and 'first' for pairs with an
+	 * integral 'first', as sorting records by their ID
+	 */
+	template < class T, class = void >
+	struct radix_key;
+
+	template < class T >
+	struct radix_key<T, typename enable_if<is_integral<T>::value>::type>
+	{
+		const T &operator()(const T &val) const { return val; }
+	};
+
+	template < class T1, class T2 >
+	struct radix_key<pair<T1, T2>, typename enable_if<is_integral<T1>::value>::type>
+	{
+		const T1 &operator()(const pair<T1, T2> &val) const { return val.first; }
+	};
+
+	/* Orders elements by comparing their keys, for short ranges */
+	template < class KeyExtractor >
+	struct _radix_key_less
+	{
+		KeyExtractor &key;
+
+		explicit _radix_key_less(KeyExtractor &k) : key(k) { }
+
+		template < class T >
+		bool operator()(const T &a, const T &b) { return key(a) < key(b); }
+	};
+
+	/**
+	 * Maps an integral key to an unsigned one in the same order
+	 * @details Flipping the sign bit moves negative keys below the positive ones
+	 */
+	template < class Key >
+	typename make_unsigned<Key>::type _radix_bits(const Key &key)
+	{
+		typedef typename make_unsigned<Key>::type bits_type;
+		const bits_type bits = static_cast<bits_type>(key);
+		if (Key(-1) < Key(0))
+			return bits ^ static_cast<bits_type>(bits_type(1) << (sizeof(Key) * CHAR_BIT - 1));
+		return bits;
+	}
+
+	template < class Key, class KeyExtractor, class T >
+	unsigned int _radix_digit(KeyExtractor &key, const T &val, unsigned int shift)
+	{
+		return static_cast<unsigned int>(ft::_radix_bits<Key>(key(val)) >> shift) & 0xff;
+	}
+
+	/**
+	 * Counts the low bytes in which the keys of the 'n' elements of 'src' differ, by or-ing their differences
+	 * with the first key
+	 * @return Number of bytes up to the most significant one that differs, 0 if all keys are equal
+	 */
+	template < class Key, class Source, class KeyExtractor >
+	std::size_t _radix_differing_bytes(Source src, std::size_t n, KeyExtractor &key)
+	{
+		typedef typename make_unsigned<Key>::type bits_type;
+		const bits_type base = ft::_radix_bits<Key>(key(src[ 0 ]));
+		bits_type diff = 0;
+		for (std::size_t i = 1; i < n; ++i)
+			diff |= static_cast<bits_type>(ft::_radix_bits<Key>(key(src[ i ])) ^ base);
+		std::size_t bytes = 0;
+		for (; diff != 0; diff >>= CHAR_BIT)
+			++bytes;
+		return bytes;
+	}
+
+	/* Counts the elements of 'src' per value of each of the 'bytes' low bytes of their key, in one pass */
+	template < class Key, class Source, class KeyExtractor >
+	void _radix_histograms(Source src, std::size_t n, KeyExtractor &key, std::size_t bytes,
+						   std::size_t (*counts)[ 256 ])
+	{
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			typename make_unsigned<Key>::type bits = ft::_radix_bits<Key>(key(src[ i ]));
+			for (std::size_t byte = 0; byte < bytes; ++byte, bits >>= CHAR_BIT)
+				++counts[ byte ][ bits & 0xff ];
+		}
+	}
+
+	/* Counts the elements of 'src' per value of their key byte at 'shift' */
+	template < class Key, class Source, class KeyExtractor >
+	void _radix_histogram(Source src, std::size_t n, KeyExtractor &key, unsigned int shift, std::size_t *counts)
+	{
+		for (std::size_t i = 0; i < n; ++i)
+			++counts[ ft::_radix_digit<Key>(key, src[ i ], shift) ];
+	}
+
+	/* Turns bucket counts into the offset of each bucket, telling whether a single bucket holds all 'n' */
+	inline bool _radix_offsets(std::size_t *counts, std::size_t n)
+	{
+		bool single_bucket = false;
+		std::size_t sum = 0;
+		for (std::size_t digit = 0; digit < 256; ++digit)
+		{
+			const std::size_t count = counts[ digit ];
+			single_bucket |= (count == n);
+			counts[ digit ] = sum;
+			sum += count;
+		}
+		return single_bucket;
+	}
+
+	/**
+	 * Moves the 'n' elements of 'src' to 'dst', each to the next free slot of the bucket of its byte at 'shift'
+	 * @details Stable, as elements are visited and placed in order within each bucket
+	 */
+	template < class Key, class Source, class Destination, class KeyExtractor >
+	void _radix_scatter(Source src, Destination dst, std::size_t n, KeyExtractor &key, unsigned int shift,
+						std::size_t *offsets)
+	{
+		for (std::size_t i = 0; i < n; ++i)
+			dst[ offsets[ ft::_radix_digit<Key>(key, src[ i ], shift) ]++ ] = ft::move(src[ i ]);
+	}
+
+	/**
+	 * Sorts on the 'bytes' low bytes of the keys, least significant first, moving the elements back and forth
+	 * between [first, first + n) and 'buffer'
+	 * @details Bytes every key shares are skipped, as their pass would not reorder anything
+	 * @return Whether the sorted elements ended up in 'buffer'
+	 */
+	template < class Key, class RandomAccessIterator, class T, class KeyExtractor >
+	bool _radix_sort_lsd(RandomAccessIterator first, T *buffer, std::size_t n, bool in_buffer, KeyExtractor &key,
+						 std::size_t bytes)
+	{
+		std::size_t counts[ sizeof(Key) ][ 256 ] = { };
+		if (in_buffer)
+			ft::_radix_histograms<Key>(buffer, n, key, bytes, counts);
+		else
+			ft::_radix_histograms<Key>(first, n, key, bytes, counts);
+		for (std::size_t byte = 0; byte < bytes; ++byte)
+		{
+			if (ft::_radix_offsets(counts[ byte ], n))
+				continue;
+			const unsigned int shift = static_cast<unsigned int>(byte * CHAR_BIT);
+			if (in_buffer)
+				ft::_radix_scatter<Key>(buffer, first, n, key, shift, counts[ byte ]);
+			else
+				ft::_radix_scatter<Key>(first, buffer, n, key, shift, counts[ byte ]);
+			in_buffer = !in_buffer;
+		}
+		return in_buffer;
+	}
+
+	/**
+	 * Sorts the bucket of 'n' elements at 'first', or at 'buffer' when 'in_buffer' is set, leaving it at 'first'
+	 * @details Buckets larger than the cache are split on the most significant byte in which their keys differ,
+	 * and each part is sorted the same way from where the split left it. Smaller buckets are sorted least
+	 * significant byte first, and the shortest are insertion sorted.
+	 */
+	template < class Key, class RandomAccessIterator, class T, class KeyExtractor >
+	void _radix_sort_bucket(RandomAccessIterator first, T *buffer, std::size_t n, bool in_buffer, KeyExtractor &key)
+	{
+		if (n < _radix_sort_insertion_threshold)
+		{
+			if (in_buffer)
+				ft::move(buffer, buffer + n, first);
+			_radix_key_less<KeyExtractor> comp(key);
+			ft::_insertion_sort(first, first + n, comp);
+			return;
+		}
+		const std::size_t bytes = in_buffer ? ft::_radix_differing_bytes<Key>(buffer, n, key)
+											: ft::_radix_differing_bytes<Key>(first, n, key);
+		if (bytes < 2 || n * sizeof(T) <= _radix_sort_lsd_bytes)
+		{
+			if (ft::_radix_sort_lsd<Key>(first, buffer, n, in_buffer, key, bytes))
+				ft::move(buffer, buffer + n, first);
+			return;
+		}
+
+		const unsigned int shift = static_cast<unsigned int>((bytes - 1) * CHAR_BIT);
+		std::size_t offsets[ 257 ] = { };
+		std::size_t next[ 256 ];
+		if (in_buffer)
+			ft::_radix_histogram<Key>(buffer, n, key, shift, offsets);
+		else
+			ft::_radix_histogram<Key>(first, n, key, shift, offsets);
+		ft::_radix_offsets(offsets, n);
+		offsets[ 256 ] = n;
+		ft::copy(offsets, offsets + 256, next);
+		if (in_buffer)
+			ft::_radix_scatter<Key>(buffer, first, n, key, shift, next);
+		else
+			ft::_radix_scatter<Key>(first, buffer, n, key, shift, next);
+		for (std::size_t digit = 0; digit < 256; ++digit)
+		{
+			const std::size_t start = offsets[ digit ];
+			ft::_radix_sort_bucket<Key>(first + start, buffer + start, offsets[ digit + 1 ] - start, !in_buffer, key);
+		}
+	}
+
+	/* Trivially copyable elements are copied straight into the raw buffer and back */
+	template < class Key, class RandomAccessIterator, class T, class KeyExtractor >
+	void _radix_sort(RandomAccessIterator first, std::size_t n, T *buffer, KeyExtractor &key, true_type)
+	{
+		ft::_radix_sort_bucket<Key>(first, buffer, n, false, key);
+	}
+
+	/* Other elements are first moved into the buffer, so that every pass assigns to live elements */
+	template < class Key, class RandomAccessIterator, class T, class KeyExtractor >
+	void _radix_sort(RandomAccessIterator first, std::size_t n, T *buffer, KeyExtractor &key, false_type)
+	{
+		T *const buffer_end = ft::_move_to_buffer(first, first + n, buffer);
+		try
+		{
+			ft::_radix_sort_bucket<Key>(first, buffer, n, true, key);
+		}
+		catch (...)
+		{
+			ft::_destroy_buffer(buffer, buffer_end);
+			throw;
+		}
+		ft::_destroy_buffer(buffer, buffer_end);
+	}
+
+	/* The key type is deduced from 'sample', the key of the first element */
+	template < class RandomAccessIterator, class KeyExtractor, class Key >
+	void _radix_sort(RandomAccessIterator first, RandomAccessIterator last, KeyExtractor &key, const Key & /* sample */)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+		const std::size_t n = static_cast<std::size_t>(last - first);
+		value_type *buffer = NULL;
+		if (n >= _radix_sort_threshold)
+			buffer = static_cast<value_type *>(::operator new(n * sizeof(value_type), std::nothrow));
+		if (buffer == NULL)
+		{
+			ft::stable_sort(first, last, _radix_key_less<KeyExtractor>(key));
+			return;
+		}
+		try
+		{
+			ft::_radix_sort<Key>(first, n, buffer, key, is_trivially_copyable<value_type>());
+		}
+		catch (...)
+		{
+			::operator delete(buffer);
+			throw;
+		}
+		::operator delete(buffer);
+	}
+
+	/**
+	 * Radix Sort, a stable sort of [first, last) by the integral key 'key' returns for each element
+	 * @details Sorts a byte of the keys per pass, each moving the elements to their bucket between the range
+	 * and a scratch buffer of the same length, in O(n) per byte. Ranges larger than the cache are first split
+	 * on their most significant byte, then each bucket is sorted from its least significant byte. Bytes every
+	 * key shares are skipped, so small keys in a wide type take fewer passes. Short ranges, or lacking memory
+	 * for the buffer, fall back to 'ft::stable_sort' on the keys.
+	 */
+	template < class RandomAccessIterator, class KeyExtractor >
+	void radix_sort(RandomAccessIterator first, RandomAccessIterator last, KeyExtractor key)
+	{
+		if (last - first < 2)
+			return;
+		ft::_radix_sort(first, last, key, key(*first));
+	}
+
+	template < class RandomAccessIterator >
+	void radix_sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		ft::radix_sort(first, last, radix_key<typename iterator_traits<RandomAccessIterator>::value_type>());
+	}
+} // namespace ft
@@ -0,0 +1,460 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <algorithm>
+#include "heap.hpp"
+#include "min.hpp"
+#include "../iterator/iterator_traits.hpp"
+#include "../type_traits/type_traits.hpp"
+#include "../utility/move.hpp"
+#include "../utility/pair.hpp"
+
+namespace ft
+{
+	/* Sort Tuning */
+	enum
+	{
+		/* Ranges shorter than this are insertion sorted */
+		_sort_insertion_threshold = 24,
+		/* Ranges longer than this take their pivot as the median of three medians of three */
+		_sort_ninther_threshold = 128,
+		/* Moves after which an insertion sort of a seemingly sorted range gives up */
+		_sort_partial_insertion_limit = 8,
+		/* Elements classified per block by the branchless partition */
+		_sort_block_size = 64
+	};
+
+	/**
+	 * Whether comparisons with 'Compare' are cheap and unpredictable enough for branchless partitioning
+	 * @details Holds for the standard orderings of arithmetic types, where a mispredicted branch costs more
+	 * than classifying a whole block of elements. Other comparators may be expensive or branch internally.
+	 */
+	template < class T, class Compare >
+	struct _is_branchless_comparable : public false_type { };
+
+	template < class T >
+	struct _is_branchless_comparable<T, std::less<T> > : public bool_constant<is_arithmetic<T>::value> { };
+
+	template < class T >
+	struct _is_branchless_comparable<T, std::greater<T> > : public bool_constant<is_arithmetic<T>::value> { };
+
+	template < class RandomAccessIterator >
+	void _iter_swap(RandomAccessIterator a, RandomAccessIterator b)
+	{
+		using std::swap;
+		swap(*a, *b);
+	}
+
+	template < class RandomAccessIterator, class Compare >
+	void _sort2(RandomAccessIterator a, RandomAccessIterator b, Compare &comp)
+	{
+		if (comp(*b, *a))
+			ft::_iter_swap(a, b);
+	}
+
+	/* Sorts the three elements, the median ends up at 'b' */
+	template < class RandomAccessIterator, class Compare >
+	void _sort3(RandomAccessIterator a, RandomAccessIterator b, RandomAccessIterator c, Compare &comp)
+	{
+		ft::_sort2(a, b, comp);
+		ft::_sort2(b, c, comp);
+		ft::_sort2(a, b, comp);
+	}
+
+	template < class RandomAccessIterator, class Compare >
+	void _insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare &comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+		if (first == last)
+			return;
+		for (RandomAccessIterator cur = first + 1; cur != last; ++cur)
+		{
+			RandomAccessIterator sift = cur;
+			RandomAccessIterator prev = cur - 1;
+			if (!comp(*sift, *prev))
+				continue;
+			value_type tmp(ft::move(*sift));
+			do
+			{
+				*sift = ft::move(*prev);
+				--sift;
+			} while (sift != first && comp(tmp, *--prev));
+			*sift = ft::move(tmp);
+		}
+	}
+
+	/* Insertion sort relying on an element before 'first' that is not greater than any in the range */
+	template < class RandomAccessIterator, class Compare >
+	void _unguarded_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare &comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+		if (first == last)
+			return;
+		for (RandomAccessIterator cur = first + 1; cur != last; ++cur)
+		{
+			RandomAccessIterator sift = cur;
+			RandomAccessIterator prev = cur - 1;
+			if (!comp(*sift, *prev))
+				continue;
+			value_type tmp(ft::move(*sift));
+			do
+			{
+				*sift = ft::move(*prev);
+				--sift;
+			} while (comp(tmp, *--prev));
+			*sift = ft::move(tmp);
+		}
+	}
+
+	/**
+	 * Insertion sort giving up once it has moved elements '_sort_partial_insertion_limit' times
+	 * @return Whether the range got sorted
+	 */
+	template < class RandomAccessIterator, class Compare >
+	bool _partial_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare &comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+		if (first == last)
+			return true;
+		std::size_t moves = 0;
+		for (RandomAccessIterator cur = first + 1; cur != last; ++cur)
+		{
+			if (moves > _sort_partial_insertion_limit)
+				return false;
+			RandomAccessIterator sift = cur;
+			RandomAccessIterator prev = cur - 1;
+			if (!comp(*sift, *prev))
+				continue;
+			value_type tmp(ft::move(*sift));
+			do
+			{
+				*sift = ft::move(*prev);
+				--sift;
+			} while (sift != first && comp(tmp, *--prev));
+			*sift = ft::move(tmp);
+			moves += cur - sift;
+		}
+		return true;
+	}
+
+	/**
+	 * Partitions [first, last) around the pivot at 'first', elements equal to it going right
+	 * @details Requires an element not less than the pivot in the range, which the median selection
+	 * guarantees, so that scans need no bounds checks
+	 * @return Final position of the pivot, and whether the range was already partitioned
+	 */
+	template < class RandomAccessIterator, class Compare >
+	ft::pair<RandomAccessIterator, bool>
+	_partition_right(RandomAccessIterator first, RandomAccessIterator last, Compare &comp, false_type)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+		const RandomAccessIterator begin = first;
+		value_type pivot(ft::move(*first));
+
+		while (comp(*++first, pivot));
+		if (first - 1 == begin)
+			while (first < last && !comp(*--last, pivot));
+		else
+			while (!comp(*--last, pivot));
+
+		const bool already_partitioned = !(first < last);
+		while (first < last)
+		{
+			ft::_iter_swap(first, last);
+			while (comp(*++first, pivot));
+			while (!comp(*--last, pivot));
+		}
+
+		const RandomAccessIterator pivot_pos = first - 1;
+		*begin = ft::move(*pivot_pos);
+		*pivot_pos = ft::move(pivot);
+		return ft::make_pair(pivot_pos, already_partitioned);
+	}
+
+	/**
+	 * Exchanges the misplaced elements at 'left + offsets_l[i]' and 'right - offsets_r[i]'
+	 * @details A cyclic permutation needs one move per element instead of three, but only swaps keep a
+	 * descending range linear, as they preserve its order
+	 */
+	template < class RandomAccessIterator >
+	void _swap_offsets(RandomAccessIterator left, RandomAccessIterator right, const unsigned char *offsets_l,
+					   const unsigned char *offsets_r, std::size_t num, bool use_swaps)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+		if (use_swaps)
+		{
+			for (std::size_t i = 0; i < num; ++i)
+				ft::_iter_swap(left + offsets_l[ i ], right - offsets_r[ i ]);
+			return;
+		}
+		if (num == 0)
+			return;
+		RandomAccessIterator l = left + offsets_l[ 0 ];
+		RandomAccessIterator r = right - offsets_r[ 0 ];
+		value_type tmp(ft::move(*l));
+		*l = ft::move(*r);
+		for (std::size_t i = 1; i < num; ++i)
+		{
+			l = left + offsets_l[ i ];
+			*r = ft::move(*l);
+			r = right - offsets_r[ i ];
+			*l = ft::move(*r);
+		}
+		*r = ft::move(tmp);
+	}
+
+	/**
+	 * Same as '_partition_right', without branching on comparison results
+	 * @details Block partitioning, from Edelkamp and Weiss' BlockQuicksort: each side records in a block
+	 * the offsets of its misplaced elements, incrementing the count by the comparison result instead of
+	 * branching on it, then the recorded elements are exchanged pairwise
+	 */
+	template < class RandomAccessIterator, class Compare >
+	ft::pair<RandomAccessIterator, bool>
+	_partition_right(RandomAccessIterator first, RandomAccessIterator last, Compare &comp, true_type)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+		const RandomAccessIterator begin = first;
+		value_type pivot(ft::move(*first));
+
+		while (comp(*++first, pivot));
+		if (first - 1 == begin)
+			while (first < last && !comp(*--last, pivot));
+		else
+			while (!comp(*--last, pivot));
+
+		const bool already_partitioned = !(first < last);
+		if (!already_partitioned)
+		{
+			ft::_iter_swap(first, last);
+			++first;
+
+			unsigned char offsets_l[ _sort_block_size ];
+			unsigned char offsets_r[ _sort_block_size ];
+			RandomAccessIterator base_l = first;
+			RandomAccessIterator base_r = last;
+			std::size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+			while (first < last)
+			{
+				// Only refill a side whose block is exhausted, splitting the unknown elements if both are
+				const std::size_t num_unknown = last - first;
+				const std::size_t left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+				const std::size_t right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+
+				const std::size_t count_l = ft::min<std::size_t>(left_split, _sort_block_size);
+				for (std::size_t i = 0; i < count_l; ++i)
+				{
+					offsets_l[ num_l ] = static_cast<unsigned char>(i);
+					num_l += !comp(*first, pivot);
+					++first;
+				}
+				const std::size_t count_r = ft::min<std::size_t>(right_split, _sort_block_size);
+				for (std::size_t i = 0; i < count_r;)
+				{
+					offsets_r[ num_r ] = static_cast<unsigned char>(++i);
+					num_r += comp(*--last, pivot);
+				}
+
+				const std::size_t num = ft::min(num_l, num_r);
+				ft::_swap_offsets(base_l, base_r, offsets_l + start_l, offsets_r + start_r, num, num_l == num_r);
+				num_l -= num;
+				num_r -= num;
+				start_l += num;
+				start_r += num;
+				if (num_l == 0)
+				{
+					start_l = 0;
+					base_l = first;
+				}
+				if (num_r == 0)
+				{
+					start_r = 0;
+					base_r = last;
+				}
+			}
+
+			// One side may still hold misplaced elements, they are swapped to the far end of the other
+			if (num_l != 0)
+			{
+				while (num_l--)
+					ft::_iter_swap(base_l + offsets_l[ start_l + num_l ], --last);
+				first = last;
+			}
+			if (num_r != 0)
+			{
+				while (num_r--)
+				{
+					ft::_iter_swap(base_r - offsets_r[ start_r + num_r ], first);
+					++first;
+				}
+				last = first;
+			}
+		}
+
+		const RandomAccessIterator pivot_pos = first - 1;
+		*begin = ft::move(*pivot_pos);
+		*pivot_pos = ft::move(pivot);
+		return ft::make_pair(pivot_pos, already_partitioned);
+	}
+
+	/**
+	 * Partitions [first, last) around the pivot at 'first', elements equal to it going left
+	 * @details Used when the pivot equals the element before the range, which bounds it from below: all
+	 * the elements equal to the pivot then end up on the left and need no further sorting
+	 * @return Final position of the pivot
+	 */
+	template < class RandomAccessIterator, class Compare >
+	RandomAccessIterator _partition_left(RandomAccessIterator first, RandomAccessIterator last, Compare &comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+		const RandomAccessIterator begin = first;
+		const RandomAccessIterator end = last;
+		value_type pivot(ft::move(*first));
+
+		while (comp(pivot, *--last));
+		if (last + 1 == end)
+			while (first < last && !comp(pivot, *++first));
+		else
+			while (!comp(pivot, *++first));
+
+		while (first < last)
+		{
+			ft::_iter_swap(first, last);
+			while (comp(pivot, *--last));
+			while (!comp(pivot, *++first));
+		}
+
+		const RandomAccessIterator pivot_pos = last;
+		*begin = ft::move(*pivot_pos);
+		*pivot_pos = ft::move(pivot);
+		return pivot_pos;
+	}
+
+	/* Moves the median of the range, or of its ninther for long ones, to 'first' */
+	template < class RandomAccessIterator, class Compare >
+	void _choose_pivot(RandomAccessIterator first, RandomAccessIterator last, Compare &comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		const difference_type size = last - first;
+		const difference_type half = size / 2;
+		if (size > _sort_ninther_threshold)
+		{
+			ft::_sort3(first, first + half, last - 1, comp);
+			ft::_sort3(first + 1, first + (half - 1), last - 2, comp);
+			ft::_sort3(first + 2, first + (half + 1), last - 3, comp);
+			ft::_sort3(first + (half - 1), first + half, first + (half + 1), comp);
+			ft::_iter_swap(first, first + half);
+		}
+		else
+			ft::_sort3(first + half, first, last - 1, comp);
+	}
+
+	/**
+	 * Breaks patterns of a range that partitioned badly by swapping a few elements at quarter offsets
+	 */
+	template < class RandomAccessIterator, class Distance >
+	void _shuffle_ends(RandomAccessIterator first, RandomAccessIterator last, Distance size)
+	{
+		if (size < _sort_insertion_threshold)
+			return;
+		ft::_iter_swap(first, first + size / 4);
+		ft::_iter_swap(last - 1, last - size / 4);
+		if (size > _sort_ninther_threshold)
+		{
+			ft::_iter_swap(first + 1, first + (size / 4 + 1));
+			ft::_iter_swap(first + 2, first + (size / 4 + 2));
+			ft::_iter_swap(last - 2, last - (size / 4 + 1));
+			ft::_iter_swap(last - 3, last - (size / 4 + 2));
+		}
+	}
+
+	/**
+	 * Pattern-defeating quicksort loop
+	 * @details Recurses on the left part and loops on the right one. 'bad_allowed' counts the highly
+	 * unbalanced partitions left before falling back to heapsort, which bounds the worst case to
+	 * O(n log n). 'leftmost' tells whether an element precedes the range, bounding it from below.
+	 */
+	template < class RandomAccessIterator, class Compare, class Branchless >
+	void _pdqsort(RandomAccessIterator first, RandomAccessIterator last, Compare &comp, int bad_allowed,
+				  bool leftmost)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		while (true)
+		{
+			const difference_type size = last - first;
+			if (size < _sort_insertion_threshold)
+			{
+				if (leftmost)
+					ft::_insertion_sort(first, last, comp);
+				else
+					ft::_unguarded_insertion_sort(first, last, comp);
+				return;
+			}
+
+			ft::_choose_pivot(first, last, comp);
+			// A pivot equal to the preceding element is the smallest value of the range, so all its
+			// duplicates are already in place once gathered on the left
+			if (!leftmost && !comp(*(first - 1), *first))
+			{
+				first = ft::_partition_left(first, last, comp) + 1;
+				continue;
+			}
+
+			const ft::pair<RandomAccessIterator, bool> part = ft::_partition_right(first, last, comp, Branchless());
+			const RandomAccessIterator pivot_pos = part.first;
+			const difference_type l_size = pivot_pos - first;
+			const difference_type r_size = last - (pivot_pos + 1);
+
+			if (l_size < size / 8 || r_size < size / 8)
+			{
+				if (--bad_allowed == 0)
+				{
+					ft::make_heap(first, last, comp);
+					ft::sort_heap(first, last, comp);
+					return;
+				}
+				ft::_shuffle_ends(first, pivot_pos, l_size);
+				ft::_shuffle_ends(pivot_pos + 1, last, r_size);
+			}
+			else if (part.second && ft::_partial_insertion_sort(first, pivot_pos, comp) &&
+					 ft::_partial_insertion_sort(pivot_pos + 1, last, comp))
+				return;
+
+			ft::_pdqsort<RandomAccessIterator, Compare, Branchless>(first, pivot_pos, comp, bad_allowed, leftmost);
+			first = pivot_pos + 1;
+			leftmost = false;
+		}
+	}
+
+	template < class Size >
+	int _log2(Size n)
+	{
+		int log = 0;
+		while (n >>= 1)
+			++log;
+		return log;
+	}
+
+	/**
+	 * Sort, a pattern-defeating quicksort
+	 * @details Introsort variant by Orson Peters: O(n log n) worst case through a heapsort fallback, linear
+	 * on sorted, reversed and few-distinct inputs, and branchless partitioning for arithmetic keys under
+	 * the standard orderings. Not stable.
+	 */
+	template < class RandomAccessIterator, class Compare >
+	void sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+		if (last - first < 2)
+			return;
+		ft::_pdqsort<RandomAccessIterator, Compare, _is_branchless_comparable<value_type, Compare> >(
+				first, last, comp, ft::_log2(last - first), true);
+	}
+
+	template < class RandomAccessIterator >
+	void sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		ft::sort(first, last, std::less<typename iterator_traits<RandomAccessIterator>::value_type>());
+	}
+} // namespace ft
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <functional>
+#include "sort.hpp"
+#include "min.hpp"
+#include "move.hpp"
+#include "../iterator/iterator_traits.hpp"
+#include "../utility/move.hpp"
+
+namespace ft
+{
+	/* Stable sort runs are insertion sorted up to this length before merging */
+	enum { _stable_sort_run_length = 16 };
+
+	template < class T >
+	void _destroy_buffer(T *first, T *last)
+	{
+		for (; first != last; ++first)
+			first->~T();
+	}
+
+	/**
+	 * Moves [first, last) into the raw storage at 'buffer'
+	 * @return Pointer past the last element moved
+	 */
+	template < class RandomAccessIterator, class T >
+	T *_move_to_buffer(RandomAccessIterator first, RandomAccessIterator last, T *buffer)
+	{
+		T *cur = buffer;
+		try
+		{
+			for (; first != last; ++first, ++cur)
+				::new(static_cast<void *>(cur)) T(ft::move(*first));
+		}
+		catch (...)
+		{
+			ft::_destroy_buffer(buffer, cur);
+			throw;
+		}
+		return cur;
+	}
+
+	/**
+	 * Merges the sorted runs [first, middle) and [middle, last) through 'buffer'
+	 * @details The shorter run is moved to 'buffer', raw storage for as many elements, and merged back from
+	 * its end of the range. If a comparison throws, the elements still in the buffer are moved back into
+	 * the hole they left, so that none is lost.
+	 */
+	template < class RandomAccessIterator, class T, class Compare >
+	void _merge_with_buffer(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
+							T *buffer, Compare &comp)
+	{
+		if (middle - first <= last - middle)
+		{
+			T *const buffer_end = ft::_move_to_buffer(first, middle, buffer);
+			T *left = buffer;
+			RandomAccessIterator right = middle;
+			RandomAccessIterator out = first;
+			try
+			{
+				for (; left != buffer_end && right != last; ++out)
+				{
+					if (comp(*right, *left))
+						*out = ft::move(*right++);
+					else
+						*out = ft::move(*left++);
+				}
+			}
+			catch (...)
+			{
+				ft::move(left, buffer_end, out);
+				ft::_destroy_buffer(buffer, buffer_end);
+				throw;
+			}
+			for (; left != buffer_end; ++left, ++out)
+				*out = ft::move(*left);
+			ft::_destroy_buffer(buffer, buffer_end);
+			return;
+		}
+
+		T *const buffer_end = ft::_move_to_buffer(middle, last, buffer);
+		RandomAccessIterator left = middle;
+		T *right = buffer_end;
+		RandomAccessIterator out = last;
+		try
+		{
+			while (left != first && right != buffer)
+			{
+				if (comp(*(right - 1), *(left - 1)))
+					*--out = ft::move(*--left);
+				else
+					*--out = ft::move(*--right);
+			}
+		}
+		catch (...)
+		{
+			ft::move(buffer, right, left);
+			ft::_destroy_buffer(buffer, buffer_end);
+			throw;
+		}
+		while (right != buffer)
+			*--out = ft::move(*--right);
+		ft::_destroy_buffer(buffer, buffer_end);
+	}
+
+	/* First position in the sorted range [first, last) at which 'value' could be inserted keeping it sorted */
+	template < class RandomAccessIterator, class T, class Compare >
+	RandomAccessIterator _lower_bound(RandomAccessIterator first, RandomAccessIterator last, const T &value,
+									  Compare &comp)
+	{
+		typename iterator_traits<RandomAccessIterator>::difference_type len = last - first;
+		while (len > 0)
+		{
+			const typename iterator_traits<RandomAccessIterator>::difference_type half = len / 2;
+			if (comp(*(first + half), value))
+			{
+				first += half + 1;
+				len -= half + 1;
+			}
+			else
+				len = half;
+		}
+		return first;
+	}
+
+	/* Last position in the sorted range [first, last) at which 'value' could be inserted keeping it sorted */
+	template < class RandomAccessIterator, class T, class Compare >
+	RandomAccessIterator _upper_bound(RandomAccessIterator first, RandomAccessIterator last, const T &value,
+									  Compare &comp)
+	{
+		typename iterator_traits<RandomAccessIterator>::difference_type len = last - first;
+		while (len > 0)
+		{
+			const typename iterator_traits<RandomAccessIterator>::difference_type half = len / 2;
+			if (comp(value, *(first + half)))
+				len = half;
+			else
+			{
+				first += half + 1;
+				len -= half + 1;
+			}
+		}
+		return first;
+	}
+
+	template < class RandomAccessIterator >
+	void _reverse(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		for (; last - first > 1; ++first)
+			ft::_iter_swap(first, --last);
+	}
+
+	/* Brings [middle, last) in front of [first, middle), by three reversals */
+	template < class RandomAccessIterator >
+	void _rotate(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+	{
+		if (first == middle || middle == last)
+			return;
+		ft::_reverse(first, middle);
+		ft::_reverse(middle, last);
+		ft::_reverse(first, last);
+	}
+
+	/**
+	 * Merges the sorted runs [first, middle) and [middle, last) in place, in O(n log n)
+	 * @details Splits the longer run at its middle, finds where that element goes in the other run and
+	 * rotates the two inner parts around each other, then merges both halves recursively
+	 */
+	template < class RandomAccessIterator, class Compare >
+	void _merge_without_buffer(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
+							   Compare &comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		const difference_type len_1 = middle - first;
+		const difference_type len_2 = last - middle;
+		if (len_1 == 0 || len_2 == 0)
+			return;
+		if (len_1 + len_2 == 2)
+		{
+			if (comp(*middle, *first))
+				ft::_iter_swap(first, middle);
+			return;
+		}
+		RandomAccessIterator cut_1;
+		RandomAccessIterator cut_2;
+		if (len_1 > len_2)
+		{
+			cut_1 = first + len_1 / 2;
+			cut_2 = ft::_lower_bound(middle, last, *cut_1, comp);
+		}
+		else
+		{
+			cut_2 = middle + len_2 / 2;
+			cut_1 = ft::_upper_bound(first, middle, *cut_2, comp);
+		}
+		ft::_rotate(cut_1, middle, cut_2);
+		const RandomAccessIterator new_middle = cut_1 + (cut_2 - middle);
+		ft::_merge_without_buffer(first, cut_1, new_middle, comp);
+		ft::_merge_without_buffer(new_middle, cut_2, last, comp);
+	}
+
+	/**
+	 * Stable Sort, a bottom-up merge sort keeping the order of equivalent elements
+	 * @details Insertion sorts short runs, then merges them pairwise through a buffer of half the range,
+	 * enough for the shorter of any two runs, skipping merges of runs already in order. Without memory for
+	 * the buffer, merges rotate in place instead, in O(n log^2 n).
+	 */
+	template < class RandomAccessIterator, class Compare >
+	void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+	{
+		typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+		const difference_type len = last - first;
+		if (len < 2)
+			return;
+
+		for (difference_type run = 0; run < len; run += _stable_sort_run_length)
+		{
+			const difference_type run_end = ft::min<difference_type>(run + _stable_sort_run_length, len);
+			ft::_insertion_sort(first + run, first + run_end, comp);
+		}
+		if (len <= _stable_sort_run_length)
+			return;
+
+		value_type *buffer = static_cast<value_type *>(
+				::operator new(static_cast<std::size_t>(len / 2 + 1) * sizeof(value_type), std::nothrow));
+		try
+		{
+			for (difference_type width = _stable_sort_run_length; width < len; width *= 2)
+			{
+				for (difference_type start = 0; start < len - width; start += 2 * width)
+				{
+					const RandomAccessIterator middle = first + (start + width);
+					const RandomAccessIterator end = first + ft::min<difference_type>(start + 2 * width, len);
+					if (!comp(*middle, *(middle - 1)))
+						continue;
+					if (buffer != NULL)
+						ft::_merge_with_buffer(first + start, middle, end, buffer, comp);
+					else
+						ft::_merge_without_buffer(first + start, middle, end, comp);
+				}
+			}
+		}
+		catch (...)
+		{
+			::operator delete(buffer);
+			throw;
+		}
+		::operator delete(buffer);
+	}
+
+	template < class RandomAccessIterator >
+	void stable_sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		ft::stable_sort(first, last, std::less<typename iterator_traits<RandomAccessIterator>::value_type>());
+	}
+} // namespace ft
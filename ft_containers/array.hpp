@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <algorithm>
+#include "iterator/vector_iterator.hpp"
+#include "iterator/reverse_iterator.hpp"
+#include "type_traits/type_traits.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/lexicographical_compare.hpp"
+
+namespace ft
+{
+	/**
+	 * Fixed-size array of 'N' elements stored inline
+	 * @details An aggregate like a built-in array, initialized with braces: 'ft::array<int, 3> a = {{ 1, 2, 3 }}'.
+	 * A zero-sized array still holds one unused slot, as built-in arrays cannot be empty.
+	 */
+	template < class T, std::size_t N >
+	struct array
+	{
+		/* Member Types */
+	public:
+		typedef T value_type;
+		typedef value_type &reference;
+		typedef const value_type &const_reference;
+		typedef value_type *pointer;
+		typedef const value_type *const_pointer;
+		typedef ft::random_access_iterator<value_type, array> iterator;
+		typedef ft::random_access_iterator<const value_type, array> const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
+		typedef std::size_t size_type;
+
+		/* Public Members */
+	public:
+		value_type elems[ N == 0 ? 1 : N ];
+
+		/* Iterator functions */
+	public:
+		iterator begin() { return iterator(this->elems); }
+
+		const_iterator begin() const { return const_iterator(this->elems); }
+
+		iterator end() { return iterator(this->elems + N); }
+
+		const_iterator end() const { return const_iterator(this->elems + N); }
+
+		reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+
+		reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+		const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+		/* Capacity functions */
+	public:
+		size_type size() const { return N; }
+
+		size_type max_size() const { return N; }
+
+		bool empty() const { return N == 0; }
+
+		/* Element access functions */
+	public:
+		reference operator[](size_type n) { return this->elems[ n ]; }
+
+		const_reference operator[](size_type n) const { return this->elems[ n ]; }
+
+		reference at(size_type n)
+		{
+			if (n >= N)
+				throw std::out_of_range("ft::array::at");
+			return this->elems[ n ];
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= N)
+				throw std::out_of_range("ft::array::at");
+			return this->elems[ n ];
+		}
+
+		reference front() { return this->elems[ 0 ]; }
+
+		const_reference front() const { return this->elems[ 0 ]; }
+
+		reference back() { return this->elems[ N - 1 ]; }
+
+		const_reference back() const { return this->elems[ N - 1 ]; }
+
+		pointer data() { return this->elems; }
+
+		const_pointer data() const { return this->elems; }
+
+		/* Modifiers functions */
+	public:
+		void fill(const value_type &val)
+		{
+			for (size_type i = 0; i < N; ++i)
+				this->elems[ i ] = val;
+		}
+
+		void swap(array &x)
+		{
+			for (size_type i = 0; i < N; ++i)
+			{
+				using std::swap;
+				swap(this->elems[ i ], x.elems[ i ]);
+			}
+		}
+	};
+
+	template < class T, std::size_t N >
+	struct is_trivially_relocatable<ft::array<T, N> > : bool_constant<is_trivially_relocatable<T>::value> { };
+
+	/* Relational Operators Overload */
+	template < class T, std::size_t N >
+	bool operator==(const array<T, N> &lhs, const array<T, N> &rhs)
+	{
+		return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template < class T, std::size_t N >
+	bool operator!=(const array<T, N> &lhs, const array<T, N> &rhs) { return !(lhs == rhs); }
+
+	template < class T, std::size_t N >
+	bool operator<(const array<T, N> &lhs, const array<T, N> &rhs)
+	{
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template < class T, std::size_t N >
+	bool operator<=(const array<T, N> &lhs, const array<T, N> &rhs) { return !(rhs < lhs); }
+
+	template < class T, std::size_t N >
+	bool operator>(const array<T, N> &lhs, const array<T, N> &rhs) { return rhs < lhs; }
+
+	template < class T, std::size_t N >
+	bool operator>=(const array<T, N> &lhs, const array<T, N> &rhs) { return !(lhs < rhs); }
+
+	/* Swap */
+	template < class T, std::size_t N >
+	void swap(array<T, N> &x, array<T, N> &y) { x.swap(y); }
+
+} // namespace ft
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <pthread.h>
+#include "type_traits/type_traits.hpp"
+
+namespace ft
+{
+	/* Link of a container in the compaction registry */
+	struct compaction_node
+	{
+		compaction_node *prev;
+		compaction_node *next;
+		/* Releases the spare capacity of 'owner', returning the number of bytes released */
+		std::size_t (*compact)(void *owner);
+		void *owner;
+	};
+
+	/**
+	 * Process-wide list of the containers using a 'compactable_allocator'
+	 * @details A template only so that its static members can be defined in this header. 'mutex' guards the
+	 * list, 'compacting' serializes compactions, and 'cursor' is the next node a compaction visits.
+	 */
+	template < class Dummy >
+	struct compaction_registry
+	{
+		static compaction_node head;
+		static compaction_node *cursor;
+		static pthread_mutex_t mutex;
+		static pthread_mutex_t compacting;
+	};
+
+	template < class Dummy >
+	compaction_node compaction_registry<Dummy>::head = { &compaction_registry<Dummy>::head,
+														 &compaction_registry<Dummy>::head, NULL, NULL };
+
+	template < class Dummy >
+	compaction_node *compaction_registry<Dummy>::cursor = NULL;
+
+	template < class Dummy >
+	pthread_mutex_t compaction_registry<Dummy>::mutex = PTHREAD_MUTEX_INITIALIZER;
+
+	template < class Dummy >
+	pthread_mutex_t compaction_registry<Dummy>::compacting = PTHREAD_MUTEX_INITIALIZER;
+
+	/**
+	 * Allocator keeping track of the containers it serves, so that 'ft::compact_vectors' can shrink them
+	 * all at once, e.g. after a load spike
+	 * @details Allocates like 'std::allocator'. Each instance is registered by the container embedding it,
+	 * and stays bound to it: copies and assignments leave registrations alone, and the destructor
+	 * unregisters. The registry itself is thread-safe, but compacting a container still races with its
+	 * use from another thread.
+	 */
+	template < class T >
+	class compactable_allocator : public std::allocator<T>
+	{
+		/* Member Types */
+	public:
+		template < class U >
+		struct rebind
+		{
+			typedef compactable_allocator<U> other;
+		};
+
+		/* Private Members */
+	private:
+		compaction_node _node;
+
+		/* Constructors */
+	public:
+		compactable_allocator() : std::allocator<T>() { this->_init_node(); }
+
+		compactable_allocator(const compactable_allocator &x) : std::allocator<T>(x) { this->_init_node(); }
+
+		template < class U >
+		compactable_allocator(const compactable_allocator<U> &x) : std::allocator<T>(x) { this->_init_node(); }
+
+		/* Destructors */
+	public:
+		~compactable_allocator() { this->detach(); }
+
+		/* Public Member Functions */
+	public:
+		/* Registrations are bound to the container embedding each allocator, they are not assigned */
+		compactable_allocator &operator=(const compactable_allocator &) { return *this; }
+
+		/**
+		 * Registers 'owner', to be shrunk by 'compact' on compaction
+		 * @details Called by the container embedding this allocator, once constructed
+		 */
+		void attach(void *owner, std::size_t (*compact)(void *))
+		{
+			this->detach();
+			pthread_mutex_lock(&compaction_registry<void>::mutex);
+			compaction_node &head = compaction_registry<void>::head;
+			this->_node.owner = owner;
+			this->_node.compact = compact;
+			this->_node.prev = &head;
+			this->_node.next = head.next;
+			head.next->prev = &this->_node;
+			head.next = &this->_node;
+			pthread_mutex_unlock(&compaction_registry<void>::mutex);
+		}
+
+		void detach()
+		{
+			if (this->_node.owner == NULL)
+				return;
+			pthread_mutex_lock(&compaction_registry<void>::mutex);
+			if (compaction_registry<void>::cursor == &this->_node)
+				compaction_registry<void>::cursor = this->_node.next;
+			this->_node.prev->next = this->_node.next;
+			this->_node.next->prev = this->_node.prev;
+			pthread_mutex_unlock(&compaction_registry<void>::mutex);
+			this->_init_node();
+		}
+
+		/* Private Functions */
+	private:
+		void _init_node()
+		{
+			this->_node.prev = this->_node.next = NULL;
+			this->_node.compact = NULL;
+			this->_node.owner = NULL;
+		}
+	};
+
+	template < class T >
+	struct allocator_is_compactable<ft::compactable_allocator<T> > : public true_type { };
+
+	template < class T, class U >
+	bool operator==(const compactable_allocator<T> &, const compactable_allocator<U> &) { return true; }
+
+	template < class T, class U >
+	bool operator!=(const compactable_allocator<T> &, const compactable_allocator<U> &) { return false; }
+
+	/**
+	 * Releases the spare capacity of every container using a 'compactable_allocator'
+	 * @details Must not run while other threads use those containers. The list is unlocked while a
+	 * container is compacted, as relocating its elements may register or unregister nested containers:
+	 * new ones are inserted before the cursor and removed ones move it forward.
+	 * @return Number of bytes released
+	 */
+	inline std::size_t compact_vectors()
+	{
+		typedef compaction_registry<void> registry;
+		std::size_t released = 0;
+		pthread_mutex_lock(&registry::compacting);
+		pthread_mutex_lock(&registry::mutex);
+		for (compaction_node *node = registry::head.next; node != &registry::head; node = registry::cursor)
+		{
+			registry::cursor = node->next;
+			pthread_mutex_unlock(&registry::mutex);
+			try
+			{
+				released += node->compact(node->owner);
+			}
+			catch (...)
+			{
+				// A container that cannot get a smaller buffer simply keeps its current one
+			}
+			pthread_mutex_lock(&registry::mutex);
+		}
+		registry::cursor = NULL;
+		pthread_mutex_unlock(&registry::mutex);
+		pthread_mutex_unlock(&registry::compacting);
+		return released;
+	}
+
+} // namespace ft
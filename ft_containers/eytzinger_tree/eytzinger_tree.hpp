@@ -0,0 +1,401 @@
+#pragma once
+
+#include <memory>
+#include <functional>
+#include "../iterator/iterator_traits.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "../utility/prefetch.hpp"
+#include "../utility/compiler.hpp"
+
+namespace ft
+{
+	/**
+	 * Immutable sorted sequence stored as an implicit binary search tree in Eytzinger ( BFS ) order
+	 * @details Node 'k' has its children at '2k' and '2k + 1', so the whole tree lives in one contiguous
+	 * allocation without any pointers and the top levels share a handful of cache lines.
+	 * Slot 0 is left unconstructed so that index 0 can serve as the end position.
+	 */
+	template < class T, class Compare = std::less<T>, class Allocator = std::allocator<T> >
+	class eytzinger_tree
+	{
+		/* Forward Declarations */
+	public:
+		class eytzinger_iterator;
+
+		/* Member Types */
+	public:
+		typedef T value_type;
+		typedef Compare value_compare;
+		typedef Allocator allocator_type;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::size_type size_type;
+		typedef typename allocator_type::difference_type difference_type;
+		typedef eytzinger_iterator iterator;
+		typedef eytzinger_iterator const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+		/* Iterator Subclasses */
+	public:
+		/**
+		 * Bidirectional iterator walking the implicit tree in sorted ( in-order ) order
+		 */
+		class eytzinger_iterator
+		{
+		public:
+			typedef bidirectional_iterator_tag iterator_category;
+			typedef typename eytzinger_tree::value_type value_type;
+			typedef typename eytzinger_tree::difference_type difference_type;
+			typedef typename eytzinger_tree::const_reference reference;
+			typedef typename eytzinger_tree::const_pointer pointer;
+
+		protected:
+			const_pointer _data;
+			size_type _size;
+			size_type _index;
+
+		public:
+			eytzinger_iterator() : _data(NULL), _size(0), _index(0) { }
+
+			eytzinger_iterator(const_pointer data, size_type size, size_type index) : _data(data), _size(size),
+																					   _index(index) { }
+
+			eytzinger_iterator(const eytzinger_iterator &other) : _data(other._data), _size(other._size),
+																   _index(other._index) { }
+
+			eytzinger_iterator &operator=(const eytzinger_iterator &other)
+			{
+				this->_data = other._data;
+				this->_size = other._size;
+				this->_index = other._index;
+				return (*this);
+			}
+
+			size_type get_index() const { return (_index); }
+
+			reference operator*() const { return (_data[ _index ]); }
+
+			pointer operator->() const { return (&(operator*())); }
+
+			eytzinger_iterator &operator++()
+			{
+				if (2 * _index + 1 <= _size)
+					_index = eytzinger_tree::_leftmost(2 * _index + 1, _size);
+				else
+				{
+					while (_index & 1)
+						_index >>= 1;
+					_index >>= 1;
+				}
+				return (*this);
+			}
+
+			eytzinger_iterator &operator--()
+			{
+				if (_index == 0)
+					_index = eytzinger_tree::_rightmost(1, _size);
+				else if (2 * _index <= _size)
+					_index = eytzinger_tree::_rightmost(2 * _index, _size);
+				else
+				{
+					while (_index > 1 && !(_index & 1))
+						_index >>= 1;
+					_index >>= 1;
+				}
+				return (*this);
+			}
+
+			eytzinger_iterator operator++(int)
+			{
+				eytzinger_iterator old = *this;
+				++*this;
+				return (old);
+			}
+
+			eytzinger_iterator operator--(int)
+			{
+				eytzinger_iterator old = *this;
+				--*this;
+				return (old);
+			}
+
+			friend bool operator==(const eytzinger_iterator &lhs, const eytzinger_iterator &rhs)
+			{
+				return (lhs._index == rhs._index);
+			}
+
+			friend bool operator!=(const eytzinger_iterator &lhs, const eytzinger_iterator &rhs)
+			{
+				return (!(lhs == rhs));
+			}
+		};
+
+		/* Private Members */
+	private:
+		pointer _data;
+		size_type _size;
+		value_compare _comp;
+		allocator_type _alloc;
+
+		/* Constructors */
+	public:
+		explicit eytzinger_tree(const value_compare &comp = value_compare(),
+								const allocator_type &alloc = allocator_type())
+				: _data(NULL), _size(0), _comp(comp), _alloc(alloc) { }
+
+		/**
+		 * Builds the tree from 'n' values in ascending order in O(n)
+		 * @param first Iterator to the smallest of exactly 'n' sorted values
+		 */
+		template < class InputIterator >
+		eytzinger_tree(InputIterator first, size_type n, const value_compare &comp = value_compare(),
+					   const allocator_type &alloc = allocator_type())
+				: _data(NULL), _size(0), _comp(comp), _alloc(alloc)
+		{
+			this->_build(first, n);
+		}
+
+		eytzinger_tree(const eytzinger_tree &other) : _data(NULL), _size(0), _comp(other._comp), _alloc(other._alloc)
+		{
+			this->_copy(other);
+		}
+
+#if FT_CXX11
+		/* Move Constructor, takes over the buffer of 'other' and leaves it empty */
+		eytzinger_tree(eytzinger_tree &&other)
+				: _data(NULL), _size(0), _comp(other._comp), _alloc(other._alloc)
+		{
+			this->swap(other);
+		}
+#endif
+
+		/* Destructors */
+	public:
+		~eytzinger_tree() { this->_release(); }
+
+		/* Public Member Functions */
+	public:
+		eytzinger_tree &operator=(const eytzinger_tree &other)
+		{
+			if (this == &other)
+				return *this;
+
+			this->_release();
+			this->_comp = other._comp;
+			this->_copy(other);
+			return *this;
+		}
+
+#if FT_CXX11
+		eytzinger_tree &operator=(eytzinger_tree &&other)
+		{
+			if (this == &other)
+				return *this;
+
+			this->_release();
+			this->swap(other);
+			return *this;
+		}
+#endif
+
+		/* Iterator Functions */
+	public:
+		iterator begin() const { return iterator(this->_data, this->_size, _leftmost(1, this->_size)); }
+
+		iterator end() const { return iterator(this->_data, this->_size, 0); }
+
+		reverse_iterator rbegin() const { return reverse_iterator(this->end()); }
+
+		reverse_iterator rend() const { return reverse_iterator(this->begin()); }
+
+		/* Capacity Functions */
+	public:
+		bool empty() const { return this->_size == 0; }
+
+		size_type size() const { return this->_size; }
+
+		size_type max_size() const { return this->_alloc.max_size() - 1; }
+
+		/* Modifiers Functions */
+	public:
+		void swap(eytzinger_tree &other)
+		{
+			std::swap(this->_data, other._data);
+			std::swap(this->_size, other._size);
+			std::swap(this->_comp, other._comp);
+			std::swap(this->_alloc, other._alloc);
+		}
+
+		/* Search Functions */
+	public:
+		/**
+		 * Finds the first value that does not compare less than 'key'
+		 * @details The descent is branchless: each level only computes the next index from a comparison
+		 * result, while the node four levels below is prefetched so memory latency overlaps the walk
+		 * @param less Predicate returning true if a stored value orders before 'key'
+		 */
+		template < class Type, class ComparisonPredicate >
+		iterator lower_bound(const Type &key, ComparisonPredicate less) const
+		{
+			size_type k = 1;
+			while (k <= this->_size)
+			{
+				if ((k << prefetch_depth) <= this->_size)
+					ft::prefetch(this->_data + (k << prefetch_depth));
+				k = 2 * k + static_cast<size_type>(less(this->_data[ k ], key));
+			}
+			return iterator(this->_data, this->_size, _cancel_right_turns(k));
+		}
+
+		/**
+		 * Finds the first value that 'key' compares less than
+		 * @param less Predicate returning true if 'key' orders before a stored value
+		 */
+		template < class Type, class ComparisonPredicate >
+		iterator upper_bound(const Type &key, ComparisonPredicate less) const
+		{
+			size_type k = 1;
+			while (k <= this->_size)
+			{
+				if ((k << prefetch_depth) <= this->_size)
+					ft::prefetch(this->_data + (k << prefetch_depth));
+				k = 2 * k + static_cast<size_type>(!less(key, this->_data[ k ]));
+			}
+			return iterator(this->_data, this->_size, _cancel_right_turns(k));
+		}
+
+		/**
+		 * Finds a value equivalent to 'key'
+		 * @param less_value_key Predicate returning true if a stored value orders before 'key'
+		 * @param less_key_value Predicate returning true if 'key' orders before a stored value
+		 */
+		template < class Type, class ValueKeyPredicate, class KeyValuePredicate >
+		iterator search(const Type &key, ValueKeyPredicate less_value_key, KeyValuePredicate less_key_value) const
+		{
+			iterator it = this->lower_bound(key, less_value_key);
+			if (it != this->end() && less_key_value(key, *it))
+				return this->end();
+			return it;
+		}
+
+		/* Observer Functions */
+	public:
+		value_compare value_comp() const { return this->_comp; }
+
+		allocator_type get_allocator() const { return this->_alloc; }
+
+		/* Private Member Functions */
+	private:
+		/* Levels ahead of the current node whose first descendant gets prefetched */
+		static const size_type prefetch_depth = 4;
+
+		template < class InputIterator >
+		void _build(InputIterator &first, size_type n)
+		{
+			if (n == 0)
+				return;
+			this->_data = this->_alloc.allocate(n + 1);
+			try
+			{
+				this->_fill(first, 1, n);
+			}
+			catch (...)
+			{
+				/* slots were constructed in sorted order, which is how they are walked back */
+				for (iterator it(this->_data, n, _leftmost(1, n)); this->_size != 0; --this->_size, ++it)
+					this->_alloc.destroy(this->_data + it.get_index());
+				this->_alloc.deallocate(this->_data, n + 1);
+				this->_data = NULL;
+				throw;
+			}
+		}
+
+		/**
+		 * Constructs subtree 'k' from the next sorted values of 'first' by an in-order walk
+		 */
+		template < class InputIterator >
+		void _fill(InputIterator &first, size_type k, size_type n)
+		{
+			if (k > n)
+				return;
+			this->_fill(first, 2 * k, n);
+			this->_alloc.construct(this->_data + k, *first);
+			++first;
+			++this->_size;
+			this->_fill(first, 2 * k + 1, n);
+		}
+
+		void _copy(const eytzinger_tree &other)
+		{
+			if (other._size == 0)
+				return;
+			this->_data = this->_alloc.allocate(other._size + 1);
+			try
+			{
+				for (size_type k = 1; k <= other._size; ++k, ++this->_size)
+					this->_alloc.construct(this->_data + k, other._data[ k ]);
+			}
+			catch (...)
+			{
+				const size_type n = other._size;
+				this->_destroy_all();
+				this->_alloc.deallocate(this->_data, n + 1);
+				this->_data = NULL;
+				throw;
+			}
+		}
+
+		void _destroy_all()
+		{
+			for (; this->_size != 0; --this->_size)
+				this->_alloc.destroy(this->_data + this->_size);
+		}
+
+		void _release()
+		{
+			if (this->_data == NULL)
+				return;
+			const size_type n = this->_size;
+			this->_destroy_all();
+			this->_alloc.deallocate(this->_data, n + 1);
+			this->_data = NULL;
+		}
+
+		/**
+		 * Strips the trailing right turns ( set bits ) and the final left turn from a descent index
+		 * @return Index of the last node where the descent went left, or 0 if it never did
+		 */
+		static size_type _cancel_right_turns(size_type k)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return k >> __builtin_ffsl(static_cast<long>(~k));
+#else
+			while (k & 1)
+				k >>= 1;
+			return k >> 1;
+#endif
+		}
+
+		static size_type _leftmost(size_type k, size_type n)
+		{
+			if (k > n)
+				return 0;
+			while (2 * k <= n)
+				k = 2 * k;
+			return k;
+		}
+
+		static size_type _rightmost(size_type k, size_type n)
+		{
+			if (k > n)
+				return 0;
+			while (2 * k + 1 <= n)
+				k = 2 * k + 1;
+			return k;
+		}
+	};
+
+} // namespace ft
@@ -0,0 +1,256 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include "utility/pair.hpp"
+#include "iterator/reverse_iterator.hpp"
+#include "iterator/iterator_traits.hpp"
+#include "eytzinger_tree/eytzinger_tree.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/lexicographical_compare.hpp"
+#include "map.hpp"
+
+namespace ft
+{
+	/**
+	 * Read-only map built once from an 'ft::map' and laid out for lookups
+	 * @details Elements live in a single contiguous 'eytzinger_tree' instead of individually allocated
+	 * tree nodes, so 'find' and the bound functions walk cache-friendly, prefetched memory
+	 */
+	template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> > >
+	class frozen_map
+	{
+		/* Forward Declarations */
+	public:
+		class value_compare;
+
+		/* Member Types */
+	public:
+		/* Value Types */
+		typedef Key key_type;
+		typedef T mapped_type;
+		typedef ft::pair<const key_type, mapped_type> value_type;
+		typedef Compare key_compare;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+		/* Tree Types */
+		typedef ft::eytzinger_tree<value_type, value_compare, Alloc> tree_type;
+		typedef typename allocator_type::size_type size_type;
+
+		class value_compare
+		{
+			friend class frozen_map;
+
+			/* Member Types */
+		public:
+			typedef bool result_type;
+			typedef value_type first_argument_type;
+			typedef value_type second_argument_type;
+
+			/* Protected Members */
+		protected:
+			Compare comp;
+
+		public:
+			value_compare() : comp() { }
+
+			explicit value_compare(Compare c) : comp(c) { }
+
+			/* Public Member functions */
+		public:
+			bool operator()(const value_type &x, const value_type &y) const
+			{
+				return this->comp(x.first, y.first);
+			}
+		};
+
+		/* Iterator Types */
+		typedef typename tree_type::const_iterator iterator;
+		typedef typename tree_type::const_iterator const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
+
+		/* Private Member */
+	private:
+		key_compare _comp;
+		tree_type _tree;
+
+		/* Constructors */
+	public:
+		/* Default Constructor */
+		explicit frozen_map(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+				: _comp(comp), _tree(value_compare(comp), alloc) { }
+
+		/* Freezing Constructor */
+		template < class MapAlloc, class MapAggregate >
+		explicit frozen_map(const ft::map<Key, T, Compare, MapAlloc, MapAggregate> &m, const allocator_type &alloc = allocator_type())
+				: _comp(m.key_comp()), _tree(m.begin(), m.size(), value_compare(m.key_comp()), alloc) { }
+
+		/* Copy Constructor */
+		frozen_map(const frozen_map &x) : _comp(x._comp), _tree(x._tree) { }
+
+#if FT_CXX11
+		/* Move Constructor */
+		frozen_map(frozen_map &&x) : _comp(x._comp), _tree(ft::move(x._tree)) { }
+#endif
+
+		/* Public Member Functions */
+	public:
+		frozen_map &operator=(const frozen_map &x)
+		{
+			if (&x == this)
+				return *this;
+
+			this->_comp = x._comp;
+			this->_tree = x._tree;
+			return *this;
+		}
+
+#if FT_CXX11
+		frozen_map &operator=(frozen_map &&x)
+		{
+			if (this == &x)
+				return *this;
+
+			this->_comp = x._comp;
+			this->_tree = ft::move(x._tree);
+			return *this;
+		}
+#endif
+
+		/* Iterator functions */
+	public:
+		const_iterator begin() const { return this->_tree.begin(); }
+
+		const_iterator end() const { return this->_tree.end(); }
+
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+
+		const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+		/* Capacity functions */
+	public:
+		bool empty() const { return this->_tree.empty(); }
+
+		size_type size() const { return this->_tree.size(); }
+
+		size_type max_size() const { return this->_tree.max_size(); }
+
+		/* Element access functions */
+	public:
+		const mapped_type &at(const key_type &k) const
+		{
+			const_iterator it = this->find(k);
+			if (it == this->end())
+				throw std::out_of_range("Out of range");
+			return it->second;
+		}
+
+		/* Modifiers functions */
+	public:
+		void swap(frozen_map &x)
+		{
+			std::swap(this->_comp, x._comp);
+			this->_tree.swap(x._tree);
+		}
+
+		/* Observer functions */
+	public:
+		key_compare key_comp() const { return this->_comp; }
+
+		value_compare value_comp() const { return value_compare(this->_comp); }
+
+		/* Operation functions */
+	private:
+		struct pair_to_key_comp
+		{
+			key_compare comp;
+
+			explicit pair_to_key_comp(const key_compare &c) : comp(c) { }
+
+			bool operator()(const value_type &value, const key_type &key) const { return comp(value.first, key); }
+		};
+
+		struct key_to_pair_comp
+		{
+			key_compare comp;
+
+			explicit key_to_pair_comp(const key_compare &c) : comp(c) { }
+
+			bool operator()(const key_type &key, const value_type &value) const { return comp(key, value.first); }
+		};
+
+	public:
+		const_iterator find(const key_type &k) const
+		{
+			return this->_tree.search(k, pair_to_key_comp(this->_comp), key_to_pair_comp(this->_comp));
+		}
+
+		size_type count(const key_type &k) const { return this->find(k) != this->end(); }
+
+		const_iterator lower_bound(const key_type &k) const
+		{
+			return this->_tree.lower_bound(k, pair_to_key_comp(this->_comp));
+		}
+
+		const_iterator upper_bound(const key_type &k) const
+		{
+			return this->_tree.upper_bound(k, key_to_pair_comp(this->_comp));
+		}
+
+		pair<const_iterator, const_iterator> equal_range(const key_type &k) const
+		{
+			return ft::pair<const_iterator, const_iterator>(this->lower_bound(k), this->upper_bound(k));
+		}
+
+		/* Allocator functions */
+	public:
+		allocator_type get_allocator() const { return this->_tree.get_allocator(); }
+	};
+
+	/* Relational Operators Overload */
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator==(const frozen_map<Key, T, Compare, Alloc> &lhs, const frozen_map<Key, T, Compare, Alloc> &rhs)
+	{
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator!=(const frozen_map<Key, T, Compare, Alloc> &lhs, const frozen_map<Key, T, Compare, Alloc> &rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator<(const frozen_map<Key, T, Compare, Alloc> &lhs, const frozen_map<Key, T, Compare, Alloc> &rhs)
+	{
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator<=(const frozen_map<Key, T, Compare, Alloc> &lhs, const frozen_map<Key, T, Compare, Alloc> &rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator>(const frozen_map<Key, T, Compare, Alloc> &lhs, const frozen_map<Key, T, Compare, Alloc> &rhs)
+	{
+		return rhs < lhs;
+	}
+
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator>=(const frozen_map<Key, T, Compare, Alloc> &lhs, const frozen_map<Key, T, Compare, Alloc> &rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+	/* Swap */
+	template < class Key, class T, class Compare, class Alloc >
+	void swap(frozen_map<Key, T, Compare, Alloc> &x, frozen_map<Key, T, Compare, Alloc> &y) { x.swap(y); }
+} // namespace ft
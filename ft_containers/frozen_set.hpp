@@ -0,0 +1,174 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include "utility/pair.hpp"
+#include "iterator/reverse_iterator.hpp"
+#include "iterator/iterator_traits.hpp"
+#include "eytzinger_tree/eytzinger_tree.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/lexicographical_compare.hpp"
+#include "set.hpp"
+
+namespace ft
+{
+	/**
+	 * Read-only set built once from an 'ft::set' and laid out for lookups
+	 * @details Elements live in a single contiguous 'eytzinger_tree' instead of individually allocated
+	 * tree nodes, so 'find' and the bound functions walk cache-friendly, prefetched memory
+	 */
+	template < class T, class Compare = std::less<T>, class Alloc = std::allocator<T> >
+	class frozen_set
+	{
+		/* Member Types */
+	public:
+		typedef T key_type;
+		typedef T value_type;
+		typedef Compare key_compare;
+		typedef Compare value_compare;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+	private:
+		typedef ft::eytzinger_tree<value_type, value_compare, allocator_type> tree_type;
+	public:
+		typedef typename tree_type::const_iterator iterator;
+		typedef typename tree_type::const_iterator const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
+		typedef size_t size_type;
+
+		/* Private Members */
+	private:
+		value_compare _comp;
+		tree_type _tree;
+
+		/* Constructor */
+	public:
+		explicit frozen_set(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+				: _comp(comp), _tree(comp, alloc) { }
+
+		template < class SetAlloc >
+		explicit frozen_set(const ft::set<T, Compare, SetAlloc> &s, const allocator_type &alloc = allocator_type())
+				: _comp(s.key_comp()), _tree(s.begin(), s.size(), s.key_comp(), alloc) { }
+
+		frozen_set(const frozen_set &x) : _comp(x._comp), _tree(x._tree) { }
+
+#if FT_CXX11
+		frozen_set(frozen_set &&x) : _comp(x._comp), _tree(ft::move(x._tree)) { }
+#endif
+
+		/* Public Member Functions */
+	public:
+		frozen_set &operator=(const frozen_set &x)
+		{
+			if (this == &x)
+				return *this;
+
+			this->_comp = x._comp;
+			this->_tree = x._tree;
+			return *this;
+		}
+
+#if FT_CXX11
+		frozen_set &operator=(frozen_set &&x)
+		{
+			if (this == &x)
+				return *this;
+
+			this->_comp = x._comp;
+			this->_tree = ft::move(x._tree);
+			return *this;
+		}
+#endif
+
+		/* Iterator Functions */
+	public:
+		const_iterator begin() const { return this->_tree.begin(); }
+
+		const_iterator end() const { return this->_tree.end(); }
+
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+
+		const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+		/* Capacity Functions */
+	public:
+		bool empty() const { return this->_tree.empty(); }
+
+		size_type size() const { return this->_tree.size(); }
+
+		size_type max_size() const { return this->_tree.max_size(); }
+
+		/* Modifiers */
+	public:
+		void swap(frozen_set &x)
+		{
+			std::swap(this->_comp, x._comp);
+			this->_tree.swap(x._tree);
+		}
+
+		/* Observers */
+	public:
+		key_compare key_comp() const { return this->_comp; }
+
+		value_compare value_comp() const { return this->_comp; }
+
+		/* Operations */
+	public:
+		const_iterator find(const value_type &val) const { return this->_tree.search(val, this->_comp, this->_comp); }
+
+		size_type count(const value_type &val) const { return this->find(val) != this->end(); }
+
+		const_iterator lower_bound(const value_type &val) const { return this->_tree.lower_bound(val, this->_comp); }
+
+		const_iterator upper_bound(const value_type &val) const { return this->_tree.upper_bound(val, this->_comp); }
+
+		ft::pair<const_iterator, const_iterator> equal_range(const value_type &val) const
+		{
+			return ft::pair<const_iterator, const_iterator>(this->lower_bound(val), this->upper_bound(val));
+		}
+
+		/* Allocator Functions */
+	public:
+		allocator_type get_allocator() const { return this->_tree.get_allocator(); }
+	};
+
+	/* Relational Operators Overload */
+	template < class Key, class Compare, class Alloc >
+	bool operator==(const ft::frozen_set<Key, Compare, Alloc> &lhs,
+					const ft::frozen_set<Key, Compare, Alloc> &rhs)
+	{
+		return ((lhs.size() == rhs.size()) && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template < class Key, class Compare, class Alloc >
+	bool operator!=(const ft::frozen_set<Key, Compare, Alloc> &lhs,
+					const ft::frozen_set<Key, Compare, Alloc> &rhs) { return (!(lhs == rhs)); }
+
+	template < class Key, class Compare, class Alloc >
+	bool operator<(const ft::frozen_set<Key, Compare, Alloc> &lhs,
+				   const ft::frozen_set<Key, Compare, Alloc> &rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template < class Key, class Compare, class Alloc >
+	bool operator<=(const ft::frozen_set<Key, Compare, Alloc> &lhs,
+					const ft::frozen_set<Key, Compare, Alloc> &rhs) { return (!(rhs < lhs)); }
+
+	template < class Key, class Compare, class Alloc >
+	bool operator>(const ft::frozen_set<Key, Compare, Alloc> &lhs,
+				   const ft::frozen_set<Key, Compare, Alloc> &rhs) { return (rhs < lhs); }
+
+	template < class Key, class Compare, class Alloc >
+	bool operator>=(const ft::frozen_set<Key, Compare, Alloc> &lhs,
+					const ft::frozen_set<Key, Compare, Alloc> &rhs) { return (!(lhs < rhs)); }
+
+	/* Swap */
+	template < class T, class Compare, class Alloc >
+	void swap(frozen_set<T, Compare, Alloc> &x, frozen_set<T, Compare, Alloc> &y) { x.swap(y); }
+} // namespace ft
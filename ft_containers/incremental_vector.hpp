@@ -0,0 +1,490 @@
+#pragma once
+
+#include <memory>
+#include <cstring>
+#include <stdexcept>
+#include <limits>
+#include "iterator/index_iterator.hpp"
+#include "iterator/reverse_iterator.hpp"
+#include "type_traits/type_traits.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/lexicographical_compare.hpp"
+#include "algorithm/min.hpp"
+#include "algorithm/max.hpp"
+#include "utility/compiler.hpp"
+#include "utility/move.hpp"
+
+namespace ft
+{
+	/**
+	 * Vector whose growth never moves all elements at once
+	 * @details When full, it allocates a buffer of twice the capacity and appends there while the old
+	 * elements stay where they are. Every following 'push_back' or 'pop_back' first migrates
+	 * 'migration_batch' old elements to the new buffer, so no single call does more than a bounded amount
+	 * of work, and migration is complete before the new buffer fills up. While it is in progress, an
+	 * element lives in the old buffer if its index is in [migrated, old end), which costs element access
+	 * a comparison and leaves the elements non-contiguous: iterators go through indices.
+	 */
+	template < class T, class Alloc = std::allocator<T> >
+	class incremental_vector
+	{
+		/* Member Types */
+	public:
+		typedef T value_type;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+		typedef ft::index_iterator<incremental_vector, value_type> iterator;
+		typedef ft::index_iterator<const incremental_vector, const value_type> const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
+		typedef typename allocator_type::size_type size_type;
+
+		/* Number of old elements migrated by each 'push_back' or 'pop_back' */
+		static const size_type migration_batch = 2;
+
+		/* Private Members */
+	private:
+		allocator_type _alloc;
+		pointer _data;
+		size_type _size;
+		size_type _capacity;
+		/* Buffer being migrated from, still holding the elements [_migrated, _old_end) */
+		pointer _old;
+		size_type _old_capacity;
+		size_type _migrated;
+		size_type _old_end;
+
+		/* Private Functions */
+	private:
+		/* Slot of element 'i', a single unsigned comparison tells whether it is still in the old buffer */
+		pointer _slot(size_type i) const
+		{
+			return i - this->_migrated < this->_old_end - this->_migrated ? this->_old + i : this->_data + i;
+		}
+
+		bool _aliases_old(const value_type *p) const
+		{
+			return this->_old != NULL && !(p < this->_old) && p < this->_old + this->_old_capacity;
+		}
+
+		void _destroy(pointer start, pointer end)
+		{
+			this->_destroy(start, end, ft::is_trivially_destructible<value_type>());
+		}
+
+		void _destroy(pointer, pointer, ft::true_type) { }
+
+		void _destroy(pointer start, pointer end, ft::false_type)
+		{
+			for (pointer i = start; i != end; ++i)
+			{
+				this->_alloc.destroy(i);
+			}
+		}
+
+		void _release_old()
+		{
+			this->_alloc.deallocate(this->_old, this->_old_capacity);
+			this->_old = NULL;
+			this->_old_capacity = 0;
+			this->_migrated = 0;
+			this->_old_end = 0;
+		}
+
+		/* Migrates up to 'n' old elements, releasing the old buffer once it is empty */
+		void _migrate(size_type n)
+		{
+			const size_type stop = ft::min(this->_migrated + n, this->_old_end);
+			this->_migrate_to(stop, ft::is_trivially_relocatable<value_type>());
+			if (this->_migrated == this->_old_end)
+				this->_release_old();
+		}
+
+		void _migrate_to(size_type stop, ft::true_type)
+		{
+			std::memcpy(static_cast<void *>(this->_data + this->_migrated),
+						static_cast<const void *>(this->_old + this->_migrated),
+						(stop - this->_migrated) * sizeof(value_type));
+			this->_migrated = stop;
+		}
+
+		/* One element at a time, so that a throwing copy leaves every element in exactly one buffer */
+		void _migrate_to(size_type stop, ft::false_type)
+		{
+			for (; this->_migrated != stop; ++this->_migrated)
+			{
+				this->_alloc.construct(this->_data + this->_migrated,
+									   ft::move_if_noexcept(this->_old[ this->_migrated ]));
+				this->_alloc.destroy(this->_old + this->_migrated);
+			}
+		}
+
+		size_type _recommend_capacity(size_type n) const
+		{
+			const size_type max = this->max_size();
+			if (n > max)
+				throw std::length_error("ft::incremental_vector");
+			if (this->_capacity >= max / 2)
+				return max;
+			return ft::max<size_type>(this->_capacity * 2, n);
+		}
+
+		/**
+		 * Switches to a new buffer twice as large, leaving the elements in the current one to be migrated
+		 */
+		FT_NOINLINE void _grow()
+		{
+			if (this->_old != NULL)
+				this->_migrate(this->_old_end);
+			const size_type new_capacity = this->_recommend_capacity(this->_size + 1);
+			pointer new_data = this->_alloc.allocate(new_capacity);
+			if (this->_data != NULL)
+			{
+				this->_old = this->_data;
+				this->_old_capacity = this->_capacity;
+				this->_migrated = 0;
+				this->_old_end = this->_size;
+				if (this->_size == 0)
+					this->_release_old();
+			}
+			this->_data = new_data;
+			this->_capacity = new_capacity;
+		}
+
+		void _destroy_all()
+		{
+			if (this->_old != NULL)
+			{
+				_destroy(this->_old + this->_migrated, this->_old + this->_old_end);
+				_destroy(this->_data, this->_data + this->_migrated);
+				_destroy(this->_data + this->_old_end, this->_data + this->_size);
+				this->_release_old();
+			}
+			else
+				_destroy(this->_data, this->_data + this->_size);
+			this->_size = 0;
+		}
+
+		/* Constructors */
+	public:
+		/* Default Constructor */
+		explicit incremental_vector(const allocator_type &alloc = allocator_type())
+				: _alloc(alloc), _data(NULL), _size(0), _capacity(0), _old(NULL), _old_capacity(0), _migrated(0),
+				  _old_end(0) { }
+
+		/* Fill Constructor */
+		explicit incremental_vector(size_type n, const value_type &val = value_type(),
+									const allocator_type &alloc = allocator_type())
+				: _alloc(alloc), _data(NULL), _size(0), _capacity(0), _old(NULL), _old_capacity(0), _migrated(0),
+				  _old_end(0)
+		{
+			try
+			{
+				this->reserve(n);
+				for (; this->_size < n; ++this->_size)
+					this->_alloc.construct(this->_data + this->_size, val);
+			}
+			catch (...)
+			{
+				this->_destroy_all();
+				if (this->_data != NULL)
+					this->_alloc.deallocate(this->_data, this->_capacity);
+				throw;
+			}
+		}
+
+		/* Copy Constructor, the copy is contiguous */
+		incremental_vector(const incremental_vector &x)
+				: _alloc(x._alloc), _data(NULL), _size(0), _capacity(0), _old(NULL), _old_capacity(0), _migrated(0),
+				  _old_end(0)
+		{
+			try
+			{
+				this->reserve(x._size);
+				for (; this->_size < x._size; ++this->_size)
+					this->_alloc.construct(this->_data + this->_size, x[ this->_size ]);
+			}
+			catch (...)
+			{
+				this->_destroy_all();
+				if (this->_data != NULL)
+					this->_alloc.deallocate(this->_data, this->_capacity);
+				throw;
+			}
+		}
+
+#if FT_CXX11
+		/* Move Constructor, takes over both buffers of 'x' and leaves it empty */
+		incremental_vector(incremental_vector &&x) noexcept
+				: _alloc(x._alloc), _data(NULL), _size(0), _capacity(0), _old(NULL), _old_capacity(0), _migrated(0),
+				  _old_end(0)
+		{
+			this->swap(x);
+		}
+#endif
+
+		/* Destructors */
+	public:
+		~incremental_vector()
+		{
+			this->_destroy_all();
+			if (this->_data != NULL)
+				this->_alloc.deallocate(this->_data, this->_capacity);
+		}
+
+		/* Public Member Functions */
+	public:
+		incremental_vector &operator=(const incremental_vector &x)
+		{
+			if (this == &x)
+				return *this;
+
+			incremental_vector tmp(x);
+			this->swap(tmp);
+			return *this;
+		}
+
+#if FT_CXX11
+		incremental_vector &operator=(incremental_vector &&x)
+		{
+			if (this == &x)
+				return *this;
+
+			incremental_vector tmp(ft::move(x));
+			this->swap(tmp);
+			return *this;
+		}
+#endif
+
+		/* Iterator functions */
+	public:
+		iterator begin() { return iterator(this, 0); }
+
+		const_iterator begin() const { return const_iterator(this, 0); }
+
+		iterator end() { return iterator(this, this->_size); }
+
+		const_iterator end() const { return const_iterator(this, this->_size); }
+
+		reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+
+		reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+		const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+		/* Capacity functions */
+	public:
+		size_type size() const { return this->_size; }
+
+		size_type max_size() const
+		{
+			return ft::min<size_type>(this->_alloc.max_size(), std::numeric_limits<difference_type>::max());
+		}
+
+		size_type capacity() const { return this->_capacity; }
+
+		bool empty() const { return this->_size == 0; }
+
+		/* Whether elements are still left in the previous buffer */
+		bool is_migrating() const { return this->_old != NULL; }
+
+		/* Migrates all remaining old elements at once, e.g. ahead of a latency-critical phase */
+		void complete_migration()
+		{
+			if (this->_old != NULL)
+				this->_migrate(this->_old_end);
+		}
+
+		/**
+		 * Makes room for 'n' elements
+		 * @details An explicit reservation is done synchronously: it completes any migration and moves all
+		 * elements to the new buffer at once.
+		 */
+		void reserve(size_type n)
+		{
+			if (n <= this->_capacity)
+				return;
+			if (n > this->max_size())
+				throw std::length_error("ft::incremental_vector::reserve");
+
+			this->complete_migration();
+			pointer new_data = this->_alloc.allocate(n);
+			if (this->_data != NULL)
+			{
+				this->_old = this->_data;
+				this->_old_capacity = this->_capacity;
+				this->_migrated = 0;
+				this->_old_end = this->_size;
+				this->_data = new_data;
+				this->_capacity = n;
+				if (this->_size == 0)
+					this->_release_old();
+				else
+					this->_migrate(this->_old_end);
+				return;
+			}
+			this->_data = new_data;
+			this->_capacity = n;
+		}
+
+		void resize(size_type n, value_type val = value_type())
+		{
+			while (this->_size > n)
+				this->pop_back();
+			while (this->_size < n)
+				this->push_back(val);
+		}
+
+		/* Element access functions */
+	public:
+		reference operator[](size_type n) { return *this->_slot(n); }
+
+		const_reference operator[](size_type n) const { return *this->_slot(n); }
+
+		reference at(size_type n)
+		{
+			if (n >= this->_size)
+				throw std::out_of_range("ft::incremental_vector::at");
+			return *this->_slot(n);
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= this->_size)
+				throw std::out_of_range("ft::incremental_vector::at");
+			return *this->_slot(n);
+		}
+
+		reference front() { return *this->_slot(0); }
+
+		const_reference front() const { return *this->_slot(0); }
+
+		reference back() { return *this->_slot(this->_size - 1); }
+
+		const_reference back() const { return *this->_slot(this->_size - 1); }
+
+		/* Modifiers functions */
+	public:
+		/**
+		 * Appends 'val' in bounded time
+		 * @details Migrates a batch of old elements first, so a throw leaves the contents unchanged. 'val' is
+		 * copied beforehand if it is one of the elements about to be migrated.
+		 */
+		void push_back(const value_type &val)
+		{
+			if (this->_old != NULL)
+			{
+				if (this->_aliases_old(&val))
+				{
+					const value_type val_copy(val);
+					this->push_back(val_copy);
+					return;
+				}
+				this->_migrate(migration_batch);
+			}
+			if (this->_size == this->_capacity)
+				this->_grow();
+			this->_alloc.construct(this->_data + this->_size, val);
+			++this->_size;
+		}
+
+#if FT_CXX11
+		void push_back(value_type &&val) { this->emplace_back(ft::move(val)); }
+
+		/* 'args' must not refer to elements of this vector, which migration may move */
+		template < class... Args >
+		void emplace_back(Args &&...args)
+		{
+			if (this->_old != NULL)
+				this->_migrate(migration_batch);
+			if (this->_size == this->_capacity)
+				this->_grow();
+			this->_alloc.construct(this->_data + this->_size, ft::forward<Args>(args)...);
+			++this->_size;
+		}
+#endif
+
+		void pop_back()
+		{
+			if (this->_old != NULL)
+				this->_migrate(migration_batch);
+			--this->_size;
+			this->_alloc.destroy(this->_slot(this->_size));
+			if (this->_old != NULL && this->_old_end > this->_size)
+			{
+				this->_old_end = this->_size;
+				if (this->_migrated == this->_old_end)
+					this->_release_old();
+			}
+		}
+
+		void swap(incremental_vector &x)
+		{
+			std::swap(this->_alloc, x._alloc);
+			std::swap(this->_data, x._data);
+			std::swap(this->_size, x._size);
+			std::swap(this->_capacity, x._capacity);
+			std::swap(this->_old, x._old);
+			std::swap(this->_old_capacity, x._old_capacity);
+			std::swap(this->_migrated, x._migrated);
+			std::swap(this->_old_end, x._old_end);
+		}
+
+		void clear() { this->_destroy_all(); }
+
+		/* Allocator functions */
+	public:
+		allocator_type get_allocator() const { return this->_alloc; }
+	};
+
+	template < class T, class Alloc >
+	const typename incremental_vector<T, Alloc>::size_type incremental_vector<T, Alloc>::migration_batch;
+
+	/* Relational Operators Overload */
+	template < class T, class Alloc >
+	bool operator==(const incremental_vector<T, Alloc> &lhs, const incremental_vector<T, Alloc> &rhs)
+	{
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template < class T, class Alloc >
+	bool operator!=(const incremental_vector<T, Alloc> &lhs, const incremental_vector<T, Alloc> &rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template < class T, class Alloc >
+	bool operator<(const incremental_vector<T, Alloc> &lhs, const incremental_vector<T, Alloc> &rhs)
+	{
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template < class T, class Alloc >
+	bool operator<=(const incremental_vector<T, Alloc> &lhs, const incremental_vector<T, Alloc> &rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+	template < class T, class Alloc >
+	bool operator>(const incremental_vector<T, Alloc> &lhs, const incremental_vector<T, Alloc> &rhs)
+	{
+		return rhs < lhs;
+	}
+
+	template < class T, class Alloc >
+	bool operator>=(const incremental_vector<T, Alloc> &lhs, const incremental_vector<T, Alloc> &rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+	/* Swap */
+	template < class T, class Alloc >
+	void swap(incremental_vector<T, Alloc> &x, incremental_vector<T, Alloc> &y) { x.swap(y); }
+
+} // namespace ft
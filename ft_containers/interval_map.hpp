@@ -0,0 +1,388 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include "utility/pair.hpp"
+#include "iterator/reverse_iterator.hpp"
+#include "iterator/iterator_traits.hpp"
+#include "red_black_tree/red_black_tree.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/lexicographical_compare.hpp"
+#include "map.hpp"
+
+namespace ft
+{
+	/**
+	 * Map keyed by half-open intervals [first, second) answering overlap and stabbing queries
+	 * @details Intervals are ordered by start, then by end. Every tree node additionally keeps the
+	 * greatest end point of its subtree, which lets queries skip subtrees that end before the query
+	 * starts. Reporting k intervals visits the ancestors of the reported nodes besides one search path, which
+	 * is O(log n + k log(n / k)) rather than O(log n + k): reported intervals scattered among intervals that end
+	 * before the query each cost a path from their nearest reported ancestor.
+	 */
+	template < class Key, class T, class Compare = std::less<Key>,
+			class Alloc = std::allocator<ft::pair<const ft::pair<Key, Key>, T> > >
+	class interval_map
+	{
+		/* Member Types */
+	public:
+		typedef ft::pair<Key, Key> interval_type;
+		typedef Key point_type;
+		typedef T mapped_type;
+		typedef interval_type key_type;
+		typedef ft::pair<const key_type, mapped_type> value_type;
+		typedef Compare point_compare;
+
+		/* Lexicographic ( start, end ) order of intervals */
+		struct key_compare
+		{
+			bool operator()(const interval_type &x, const interval_type &y) const
+			{
+				point_compare comp;
+				return comp(x.first, y.first) || (!comp(y.first, x.first) && comp(x.second, y.second));
+			}
+		};
+
+		/* Greatest end point of a subtree, 'first' is false for empty subtrees */
+		struct max_end_aggregate
+		{
+			typedef ft::pair<bool, point_type> result_type;
+
+			result_type identity() const { return result_type(false, point_type()); }
+
+			result_type operator()(const value_type &value) const { return result_type(true, value.first.second); }
+
+			result_type combine(const result_type &lhs, const result_type &rhs) const
+			{
+				if (!lhs.first)
+					return rhs;
+				if (!rhs.first)
+					return lhs;
+				return point_compare()(lhs.second, rhs.second) ? rhs : lhs;
+			}
+		};
+
+	private:
+		typedef ft::map<key_type, mapped_type, key_compare, Alloc, max_end_aggregate> map_type;
+	public:
+		typedef typename map_type::value_compare value_compare;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+		/* Tree Types */
+		typedef typename map_type::tree_type tree_type;
+		typedef typename tree_type::node_pointer node_pointer;
+		typedef typename allocator_type::size_type size_type;
+		/* Iterator Types */
+		typedef typename map_type::iterator iterator;
+		typedef typename map_type::const_iterator const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
+
+		/* Private Member */
+	private:
+		point_compare _comp;
+		allocator_type _alloc;
+		tree_type _rbt;
+
+		/* Constructors */
+	public:
+		/* Default Constructor */
+		explicit interval_map(const allocator_type &alloc = allocator_type()) : _comp(), _alloc(alloc), _rbt() { }
+
+		/* Range Constructor */
+		template < class InputIterator >
+		interval_map(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type())
+				: _comp(), _alloc(alloc), _rbt()
+		{
+			this->insert(first, last);
+		}
+
+		/* Copy Constructor */
+		interval_map(const interval_map &x) : _comp(x._comp), _alloc(x._alloc), _rbt(x._rbt) { }
+
+#if FT_CXX11
+		/* Move Constructor */
+		interval_map(interval_map &&x) : _comp(x._comp), _alloc(x._alloc), _rbt(ft::move(x._rbt)) { }
+#endif
+
+		/* Destructors */
+	public:
+		~interval_map() { this->_rbt.clear(); }
+
+		/* Public Member Functions */
+	public:
+		interval_map &operator=(const interval_map &x)
+		{
+			if (&x == this)
+				return *this;
+
+			this->_rbt = x._rbt;
+			this->_alloc = x._alloc;
+			return *this;
+		}
+
+#if FT_CXX11
+		interval_map &operator=(interval_map &&x)
+		{
+			if (&x == this)
+				return *this;
+
+			this->_rbt = ft::move(x._rbt);
+			this->_alloc = x._alloc;
+			return *this;
+		}
+#endif
+
+		/* Iterator functions */
+	public:
+		iterator begin() { return iterator(this->_rbt.begin()); }
+
+		const_iterator begin() const { return const_iterator(this->_rbt.begin()); }
+
+		iterator end() { return iterator(this->_rbt.end()); }
+
+		const_iterator end() const { return const_iterator(this->_rbt.end()); }
+
+		reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+
+		reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+		const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+		/* Capacity functions */
+	public:
+		bool empty() const { return this->_rbt.empty(); }
+
+		size_type size() const { return this->_rbt.size(); }
+
+		size_type max_size() const { return this->_rbt.get_node_allocator().max_size(); }
+
+		/* Modifiers functions */
+	public:
+		/* Insert Single Element */
+		ft::pair<iterator, bool> insert(const value_type &val)
+		{
+			iterator x = this->find(val.first);
+			if (x != this->end())
+				return ft::pair<iterator, bool>(x, false);
+			return ft::pair<iterator, bool>(iterator(this->_rbt.insert(val)), true);
+		}
+
+#if FT_CXX11
+		ft::pair<iterator, bool> insert(value_type &&val)
+		{
+			iterator x = this->find(val.first);
+			if (x != this->end())
+				return ft::pair<iterator, bool>(x, false);
+			return ft::pair<iterator, bool>(iterator(this->_rbt.insert(ft::move(val))), true);
+		}
+#endif
+
+		/* Insert [start, end) */
+		ft::pair<iterator, bool> insert(const point_type &start, const point_type &end, const mapped_type &val)
+		{
+			return this->insert(value_type(interval_type(start, end), val));
+		}
+
+		/* Insert Range */
+		template < class InputIterator >
+		void insert(InputIterator first, InputIterator last)
+		{
+			for (InputIterator it = first; it != last; ++it)
+				this->insert(*it);
+		}
+
+		/* Erase functions */
+		void erase(iterator position)
+		{
+			if (position == this->end())
+				return;
+			this->_rbt.erase(position.base());
+		}
+
+		size_type erase(const key_type &k)
+		{
+			iterator it = this->find(k);
+			if (it == this->end())
+				return 0;
+			this->_rbt.erase(it.base());
+			return 1;
+		}
+
+		void erase(iterator first, iterator last) { this->_rbt.erase(first.base(), last.base()); }
+
+		/* Swap function */
+		void swap(interval_map &x) { this->_rbt.swap(x._rbt); }
+
+		/* Clear function */
+		void clear() { this->_rbt.clear(); }
+
+		/* Observer functions */
+	public:
+		key_compare key_comp() const { return key_compare(); }
+
+		value_compare value_comp() const { return value_compare(key_compare()); }
+
+		/* Operation functions */
+	private:
+		struct pair_to_key_comp
+		{
+			bool operator()(const value_type &value, const key_type &key) const
+			{
+				return key_compare()(value.first, key);
+			}
+		};
+
+	public:
+		iterator find(const key_type &k)
+		{
+			iterator it(this->_rbt.lower_bound(k, pair_to_key_comp()));
+			if (it == this->end() || key_compare()(k, it->first))
+				return this->end();
+			return it;
+		}
+
+		const_iterator find(const key_type &k) const
+		{
+			const_iterator it(this->_rbt.lower_bound(k, pair_to_key_comp()));
+			if (it == this->end() || key_compare()(k, it->first))
+				return this->end();
+			return it;
+		}
+
+		size_type count(const key_type &k) const { return this->find(k) != this->end(); }
+
+		/* Interval Query functions */
+	public:
+		/**
+		 * Writes an iterator to every stored interval overlapping [start, end), in ascending order
+		 * @return Output iterator past the last written iterator
+		 */
+		template < class OutputIterator >
+		OutputIterator overlapping(const point_type &start, const point_type &end, OutputIterator out)
+		{
+			return this->_collect<iterator>(this->_rbt.root(), start, end, false, out);
+		}
+
+		template < class OutputIterator >
+		OutputIterator overlapping(const point_type &start, const point_type &end, OutputIterator out) const
+		{
+			return this->_collect<const_iterator>(this->_rbt.root(), start, end, false, out);
+		}
+
+		/**
+		 * Writes an iterator to every stored interval containing 'point', in ascending order
+		 * @return Output iterator past the last written iterator
+		 */
+		template < class OutputIterator >
+		OutputIterator stabbing(const point_type &point, OutputIterator out)
+		{
+			return this->_collect<iterator>(this->_rbt.root(), point, point, true, out);
+		}
+
+		template < class OutputIterator >
+		OutputIterator stabbing(const point_type &point, OutputIterator out) const
+		{
+			return this->_collect<const_iterator>(this->_rbt.root(), point, point, true, out);
+		}
+
+		/* Returns whether any stored interval overlaps [start, end) */
+		bool overlaps(const point_type &start, const point_type &end) const
+		{
+			for (node_pointer x = this->_rbt.root(); x != tree_type::nil();)
+			{
+				if (!x->aggregate.first || !this->_comp(start, x->aggregate.second))
+					return false;
+				if (x->left != tree_type::nil() && x->left->aggregate.first
+					&& this->_comp(start, x->left->aggregate.second))
+					x = x->left;
+				else if (!this->_comp(x->value.first.first, end))
+					return false;
+				else if (this->_comp(start, x->value.first.second))
+					return true;
+				else
+					x = x->right;
+			}
+			return false;
+		}
+
+		/* Allocator functions */
+	public:
+		allocator_type get_allocator() const { return this->_alloc; }
+
+		/* Private Member Functions */
+	private:
+		/**
+		 * Reports the intervals of subtree 'x' ending after 'start' and starting before 'end'
+		 * ( or at 'end' if 'end_inclusive' ), skipping subtrees whose greatest end point is not after 'start'
+		 * @details Every subtree entered holds a reported interval, but reaching it may take a path of nodes
+		 * that are not reported, which makes the walk O(log n) per reported interval at worst
+		 */
+		template < class Result, class OutputIterator >
+		OutputIterator _collect(node_pointer x, const point_type &start, const point_type &end, bool end_inclusive,
+								OutputIterator out) const
+		{
+			while (x != tree_type::nil() && x->aggregate.first && this->_comp(start, x->aggregate.second))
+			{
+				out = this->_collect<Result>(x->left, start, end, end_inclusive, out);
+				const point_type &x_start = x->value.first.first;
+				if (end_inclusive ? this->_comp(end, x_start) : !this->_comp(x_start, end))
+					break;
+				if (this->_comp(start, x->value.first.second))
+				{
+					*out = Result(typename tree_type::iterator(x));
+					++out;
+				}
+				x = x->right;
+			}
+			return out;
+		}
+	};
+
+	/* Relational Operators Overload */
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator==(const interval_map<Key, T, Compare, Alloc> &lhs, const interval_map<Key, T, Compare, Alloc> &rhs)
+	{
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator!=(const interval_map<Key, T, Compare, Alloc> &lhs, const interval_map<Key, T, Compare, Alloc> &rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator<(const interval_map<Key, T, Compare, Alloc> &lhs, const interval_map<Key, T, Compare, Alloc> &rhs)
+	{
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator<=(const interval_map<Key, T, Compare, Alloc> &lhs, const interval_map<Key, T, Compare, Alloc> &rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator>(const interval_map<Key, T, Compare, Alloc> &lhs, const interval_map<Key, T, Compare, Alloc> &rhs)
+	{
+		return rhs < lhs;
+	}
+
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator>=(const interval_map<Key, T, Compare, Alloc> &lhs, const interval_map<Key, T, Compare, Alloc> &rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+	/* Swap */
+	template < class Key, class T, class Compare, class Alloc >
+	void swap(interval_map<Key, T, Compare, Alloc> &x, interval_map<Key, T, Compare, Alloc> &y) { x.swap(y); }
+} // namespace ft
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstddef>
+#include "iterator_traits.hpp"
+
+namespace ft
+{
+	/* Index Iterator */
+	/**
+	 * Random access iterator addressing an element by its index in a container's 'operator[]'
+	 * @details For containers whose elements are not contiguous, such as a vector whose elements are split
+	 * across two buffers. 'Container' and 'T' are const for the const iterator.
+	 */
+	template < class Container, class T >
+	class index_iterator
+	{
+		/* Iterator Tags */
+	public:
+		typedef random_access_iterator_tag iterator_category;
+		typedef ptrdiff_t difference_type;
+		typedef T value_type;
+		typedef value_type &reference;
+		typedef value_type *pointer;
+
+		/* Private Members */
+	private:
+		Container *_container;
+		difference_type _index;
+
+		/* Constructors */
+	public:
+		index_iterator() : _container(NULL), _index(0) { }
+
+		index_iterator(Container *container, difference_type index) : _container(container), _index(index) { }
+
+		/* Converts an iterator to a const iterator */
+		template < class C, class U >
+		index_iterator(const index_iterator<C, U> &other) : _container(other.container()), _index(other.index()) { }
+
+		/* Member Functions */
+	public:
+		Container *container() const { return this->_container; }
+
+		difference_type index() const { return this->_index; }
+
+		/* Dereference Operators */
+	public:
+		reference operator*() const { return (*this->_container)[ this->_index ]; }
+
+		pointer operator->() const { return &(*this->_container)[ this->_index ]; }
+
+		reference operator[](difference_type n) const { return (*this->_container)[ this->_index + n ]; }
+
+		/* Increment Operators */
+	public:
+		index_iterator &operator++()
+		{
+			++this->_index;
+			return *this;
+		}
+
+		index_iterator operator++(int)
+		{
+			index_iterator tmp = *this;
+			++this->_index;
+			return tmp;
+		}
+
+		/* Decrement Operators */
+	public:
+		index_iterator &operator--()
+		{
+			--this->_index;
+			return *this;
+		}
+
+		index_iterator operator--(int)
+		{
+			index_iterator tmp = *this;
+			--this->_index;
+			return tmp;
+		}
+
+		/* Arithmetic Operators */
+	public:
+		index_iterator operator+(difference_type n) const { return index_iterator(this->_container, this->_index + n); }
+
+		index_iterator operator-(difference_type n) const { return index_iterator(this->_container, this->_index - n); }
+
+		/* Compound Assignment Operators */
+	public:
+		index_iterator &operator+=(difference_type n)
+		{
+			this->_index += n;
+			return *this;
+		}
+
+		index_iterator &operator-=(difference_type n)
+		{
+			this->_index -= n;
+			return *this;
+		}
+	};
+
+	/* Index Iterator Non-Member Overloads */
+
+	/* Arithmetic Operators */
+	template < class Container, class T >
+	index_iterator<Container, T> operator+(typename index_iterator<Container, T>::difference_type n,
+										   const index_iterator<Container, T> &it) { return it + n; }
+
+	template < class C1, class T1, class C2, class T2 >
+	typename index_iterator<C1, T1>::difference_type operator-(const index_iterator<C1, T1> &lhs,
+															   const index_iterator<C2, T2> &rhs)
+	{
+		return lhs.index() - rhs.index();
+	}
+
+	/* Comparison Operators, iterators and const iterators of a container compare by index */
+	template < class C1, class T1, class C2, class T2 >
+	bool operator==(const index_iterator<C1, T1> &lhs, const index_iterator<C2, T2> &rhs)
+	{
+		return lhs.index() == rhs.index();
+	}
+
+	template < class C1, class T1, class C2, class T2 >
+	bool operator!=(const index_iterator<C1, T1> &lhs, const index_iterator<C2, T2> &rhs)
+	{
+		return lhs.index() != rhs.index();
+	}
+
+	template < class C1, class T1, class C2, class T2 >
+	bool operator<(const index_iterator<C1, T1> &lhs, const index_iterator<C2, T2> &rhs)
+	{
+		return lhs.index() < rhs.index();
+	}
+
+	template < class C1, class T1, class C2, class T2 >
+	bool operator>(const index_iterator<C1, T1> &lhs, const index_iterator<C2, T2> &rhs)
+	{
+		return lhs.index() > rhs.index();
+	}
+
+	template < class C1, class T1, class C2, class T2 >
+	bool operator<=(const index_iterator<C1, T1> &lhs, const index_iterator<C2, T2> &rhs)
+	{
+		return lhs.index() <= rhs.index();
+	}
+
+	template < class C1, class T1, class C2, class T2 >
+	bool operator>=(const index_iterator<C1, T1> &lhs, const index_iterator<C2, T2> &rhs)
+	{
+		return lhs.index() >= rhs.index();
+	}
+} // namespace ft
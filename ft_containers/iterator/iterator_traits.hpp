@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <iterator>
+#include "../type_traits/type_traits.hpp"
 
 namespace ft
 {
@@ -44,4 +45,22 @@ namespace ft
 		typedef std::random_access_iterator_tag iterator_category;
 	};
 
+	/**
+	 * Whether 'Iterator' addresses elements laid out contiguously in memory, as raw pointers do
+	 * @details Lets algorithms work on the underlying memory through 'ft::to_address'. Specialize it
+	 * alongside 'to_address' for own iterators over arrays.
+	 */
+	template < class Iterator >
+	struct is_contiguous_iterator : public false_type { };
+
+	template < class T >
+	struct is_contiguous_iterator<T *> : public true_type { };
+
+	template < class T >
+	struct is_contiguous_iterator<const T *> : public true_type { };
+
+	/* Address of the element a contiguous iterator refers to */
+	template < class T >
+	T *to_address(T *p) { return p; }
+
 } // namespace ft
@@ -21,7 +21,7 @@ namespace ft
 	template < class InputIterator >
 	void advance(InputIterator &i, typename iterator_traits<InputIterator>::difference_type n)
 	{
-		std::advance(i, n, typename iterator_traits<InputIterator>::iterator_category());
+		std::advance(i, n);
 	}
 
 	template < class Iterator >
@@ -3,6 +3,7 @@
 #include <iterator>
 #include <cstddef>
 #include "iterator_traits.hpp"
+#include "../type_traits/type_traits.hpp"
 
 namespace ft
 {
@@ -31,8 +32,13 @@ namespace ft
 
 		explicit random_access_iterator(pointer ptr) : _ptr(ptr) { }
 
-		random_access_iterator(const random_access_iterator<typename Container::value_type, Container> &cpy) : _ptr(
-				cpy.base()) { }
+		random_access_iterator(const random_access_iterator &cpy) : _ptr(cpy._ptr) { }
+
+		/* Mutable to constant iterator conversion, a template so that it never stands in for the copy constructor */
+		template < class U >
+		random_access_iterator(const random_access_iterator<U, Container> &cpy,
+							   typename ft::enable_if<ft::is_same<U, typename Container::value_type>::value,
+													  bool>::type = true) : _ptr(cpy.base()) { }
 
 		/* Destructors */
 	public:
@@ -231,4 +237,10 @@ namespace ft
 		return lhs.base() >= rhs.base();
 	}
 
+	template < class T, class Container >
+	struct is_contiguous_iterator<random_access_iterator<T, Container> > : public true_type { };
+
+	template < class T, class Container >
+	T *to_address(const random_access_iterator<T, Container> &it) { return it.base(); }
+
 } // namespace ft
@@ -12,7 +12,8 @@
 
 namespace ft
 {
-	template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> > >
+	template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> >,
+			class Aggregate = ft::no_aggregate<ft::pair<const Key, T> > >
 	class map
 	{
 		/* Forward Declarations */
@@ -21,7 +22,7 @@ namespace ft
 
 		/* Member Types */
 	private:
-		typedef map<Key, T, Compare, Alloc> map_type;
+		typedef map<Key, T, Compare, Alloc, Aggregate> map_type;
 	public:
 		/* Value Types */
 		typedef Key key_type;
@@ -34,10 +35,13 @@ namespace ft
 		typedef typename allocator_type::pointer pointer;
 		typedef typename allocator_type::const_pointer const_pointer;
 		/* Tree Types */
-		typedef ft::red_black_tree<value_type, value_compare, Alloc> tree_type;
+		typedef ft::red_black_tree<value_type, value_compare, Alloc, Aggregate> tree_type;
 		typedef typename tree_type::iterator tree_iterator;
 		typedef typename tree_type::const_iterator tree_const_iterator;
 		typedef typename allocator_type::size_type size_type;
+		/* Aggregate Types */
+		typedef Aggregate aggregate_type;
+		typedef typename aggregate_type::result_type aggregate_result;
 
 		class value_compare
 		{
@@ -242,6 +246,11 @@ namespace ft
 			*this = x;
 		}
 
+#if FT_CXX11
+		/* Move Constructor */
+		map(map &&x) : _compare(x._compare), _alloc(x._alloc), _rbt(ft::move(x._rbt)) { }
+#endif
+
 		/* Destructors */
 	public:
 		~map()
@@ -262,6 +271,17 @@ namespace ft
 			return *this;
 		}
 
+#if FT_CXX11
+		map &operator=(map &&x)
+		{
+			if (&x == this)
+				return *this;
+
+			this->_rbt = ft::move(x._rbt);
+			return *this;
+		}
+#endif
+
 		/* Iterator functions */
 	public:
 		iterator begin() { return iterator(this->_rbt.begin()); }
@@ -326,6 +346,16 @@ namespace ft
 			return ft::pair<iterator, bool>(iterator(this->_rbt.insert(val)), true);
 		}
 
+#if FT_CXX11
+		pair<iterator, bool> insert(value_type &&val)
+		{
+			iterator x = find(val.first);
+			if (x != this->end())
+				return ft::pair<iterator, bool>(x, false);
+			return ft::pair<iterator, bool>(iterator(this->_rbt.insert(ft::move(val))), true);
+		}
+#endif
+
 		/* Insert With Hint */
 		iterator insert(iterator position, const value_type &val)
 		{
@@ -402,6 +432,14 @@ namespace ft
 			}
 		};
 
+		struct pair_to_key_comp
+		{
+			bool operator()(const value_type &value, const key_type &key) const
+			{
+				return key_compare()(value.first, key);
+			}
+		};
+
 	public:
 		iterator find(const key_type &k)
 		{
@@ -418,6 +456,26 @@ namespace ft
 			return const_iterator(this->_rbt.search(k, key_to_pair_equal(), key_to_pair_comp()));
 		}
 
+		/**
+		 * Looks up every key in [first_key, last_key) and writes one iterator per key to 'out_iterators'
+		 * @details Searches are interleaved in the tree so their cache misses overlap, which pays off
+		 * for large batches against trees that do not fit in cache
+		 * @return Output iterator past the last written iterator
+		 */
+		template < class InputIterator, class OutputIterator >
+		OutputIterator find_batch(InputIterator first_key, InputIterator last_key, OutputIterator out_iterators)
+		{
+			return this->_rbt.template search_batch<iterator>(first_key, last_key, out_iterators,
+															  key_to_pair_equal(), key_to_pair_comp());
+		}
+
+		template < class InputIterator, class OutputIterator >
+		OutputIterator find_batch(InputIterator first_key, InputIterator last_key, OutputIterator out_iterators) const
+		{
+			return this->_rbt.template search_batch<const_iterator>(first_key, last_key, out_iterators,
+																	key_to_pair_equal(), key_to_pair_comp());
+		}
+
 		size_type count(const key_type &k) const
 		{
 			const_iterator element = this->find(k);
@@ -492,47 +550,81 @@ namespace ft
 			return ft::pair<iterator, iterator>(this->lower_bound(k), this->upper_bound(k));
 		}
 
+		/* Aggregate functions */
+	public:
+		/**
+		 * Combines the 'Aggregate' of all elements with keys in [lo, hi) in O(log n)
+		 * @details Requires a map instantiated with an aggregate other than 'ft::no_aggregate'
+		 */
+		aggregate_result aggregate(const key_type &lo, const key_type &hi) const
+		{
+			return this->_rbt.aggregate(lo, hi, pair_to_key_comp());
+		}
+
+		/* Combines the 'Aggregate' of all elements */
+		aggregate_result aggregate() const { return this->_rbt.aggregate(); }
+
+		/**
+		 * Refreshes the aggregates covering 'position' after its mapped value was modified in place
+		 * @details Writes through 'operator[]', 'at' or an iterator bypass the tree, so aggregates that
+		 * depend on mapped values go stale until this is called
+		 */
+		void update_aggregate(iterator position)
+		{
+			if (position != this->end())
+				this->_rbt.update_aggregate(position.base());
+		}
+
 		/* Allocator functions */
 	public:
 		allocator_type get_allocator() const { return this->_alloc; }
 	};
 
 	/* Relational Operators Overload */
-	template < class Key, class T, class Compare, class Alloc >
-	bool operator==(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+	template < class Key, class T, class Compare, class Alloc, class Aggregate >
+	bool operator==(const map<Key, T, Compare, Alloc, Aggregate> &lhs,
+					const map<Key, T, Compare, Alloc, Aggregate> &rhs)
 	{
 		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 	}
 
-	template < class Key, class T, class Compare, class Alloc >
-	bool operator!=(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+	template < class Key, class T, class Compare, class Alloc, class Aggregate >
+	bool operator!=(const map<Key, T, Compare, Alloc, Aggregate> &lhs,
+					const map<Key, T, Compare, Alloc, Aggregate> &rhs)
 	{
 		return !(lhs == rhs);
 	}
 
-	template < class Key, class T, class Compare, class Alloc >
-	bool operator<(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+	template < class Key, class T, class Compare, class Alloc, class Aggregate >
+	bool operator<(const map<Key, T, Compare, Alloc, Aggregate> &lhs,
+				   const map<Key, T, Compare, Alloc, Aggregate> &rhs)
 	{
 		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 	}
 
-	template < class Key, class T, class Compare, class Alloc >
-	bool operator<=(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+	template < class Key, class T, class Compare, class Alloc, class Aggregate >
+	bool operator<=(const map<Key, T, Compare, Alloc, Aggregate> &lhs,
+					const map<Key, T, Compare, Alloc, Aggregate> &rhs)
 	{
 		return !(rhs < lhs);
 	}
 
-	template < class Key, class T, class Compare, class Alloc >
-	bool operator>(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs) { return rhs < lhs; }
+	template < class Key, class T, class Compare, class Alloc, class Aggregate >
+	bool operator>(const map<Key, T, Compare, Alloc, Aggregate> &lhs,
+				   const map<Key, T, Compare, Alloc, Aggregate> &rhs)
+	{
+		return rhs < lhs;
+	}
 
-	template < class Key, class T, class Compare, class Alloc >
-	bool operator>=(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs)
+	template < class Key, class T, class Compare, class Alloc, class Aggregate >
+	bool operator>=(const map<Key, T, Compare, Alloc, Aggregate> &lhs,
+					const map<Key, T, Compare, Alloc, Aggregate> &rhs)
 	{
 		return !(lhs < rhs);
 	}
 
 
 	/* Swap */
-	template < class Key, class T, class Compare, class Alloc >
-	void swap(map<Key, T, Compare, Alloc> &x, map<Key, T, Compare, Alloc> &y) { x.swap(y); }
+	template < class Key, class T, class Compare, class Alloc, class Aggregate >
+	void swap(map<Key, T, Compare, Alloc, Aggregate> &x, map<Key, T, Compare, Alloc, Aggregate> &y) { x.swap(y); }
 } // namespace ft
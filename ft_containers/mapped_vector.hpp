@@ -0,0 +1,347 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <cerrno>
+#include <string>
+#include <stdexcept>
+#include <limits>
+#include <algorithm>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "iterator/vector_iterator.hpp"
+#include "iterator/reverse_iterator.hpp"
+#include "type_traits/type_traits.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/lexicographical_compare.hpp"
+#include "algorithm/min.hpp"
+#include "algorithm/max.hpp"
+#include "utility/compiler.hpp"
+
+namespace ft
+{
+	/**
+	 * Vector of plain records stored in a memory-mapped file
+	 * @details Opening maps the file without reading it, so its pages are loaded lazily on first access and
+	 * shared with the page cache. Appending extends the file: while open, the file is kept as large as the
+	 * capacity and the unused tail is trimmed on close, so a process killed meanwhile leaves zeroed
+	 * records past the end. 'T' must be trivially copyable, as records are stored as raw bytes and the
+	 * file is only as portable as their layout. Not copyable, since two vectors would share one file.
+	 */
+	template < class T >
+	class mapped_vector
+	{
+#if FT_CXX11
+		static_assert(ft::is_trivially_copyable<T>::value, "ft::mapped_vector requires trivially copyable records");
+#endif
+
+		/* Member Types */
+	public:
+		typedef T value_type;
+		typedef value_type &reference;
+		typedef const value_type &const_reference;
+		typedef value_type *pointer;
+		typedef const value_type *const_pointer;
+		typedef ft::random_access_iterator<value_type, mapped_vector> iterator;
+		typedef ft::random_access_iterator<const value_type, mapped_vector> const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
+		typedef std::size_t size_type;
+
+		/* Private Members */
+	private:
+		int _fd;
+		pointer _start;
+		size_type _size;
+		size_type _capacity;
+
+		/* Private Functions */
+	private:
+		static void _throw_errno(const char *what)
+		{
+			throw std::runtime_error(std::string("ft::mapped_vector: ") + what + ": " + std::strerror(errno));
+		}
+
+		/* Resizes the file and its mapping to 'n' records */
+		void _remap(size_type n)
+		{
+			const size_type old_bytes = this->_capacity * sizeof(value_type);
+			const size_type new_bytes = n * sizeof(value_type);
+			if (ftruncate(this->_fd, static_cast<off_t>(new_bytes)) == -1)
+				_throw_errno("ftruncate");
+			if (this->_start == NULL)
+			{
+				void *p = mmap(NULL, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, this->_fd, 0);
+				if (p == MAP_FAILED)
+					_throw_errno("mmap");
+				this->_start = static_cast<pointer>(p);
+			}
+			else
+			{
+#ifdef MREMAP_MAYMOVE
+				void *p = mremap(static_cast<void *>(this->_start), old_bytes, new_bytes, MREMAP_MAYMOVE);
+				if (p == MAP_FAILED)
+					_throw_errno("mremap");
+#else
+				void *p = mmap(NULL, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, this->_fd, 0);
+				if (p == MAP_FAILED)
+					_throw_errno("mmap");
+				munmap(static_cast<void *>(this->_start), old_bytes);
+#endif
+				this->_start = static_cast<pointer>(p);
+			}
+			this->_capacity = n;
+		}
+
+		size_type _recommend_capacity(size_type n) const
+		{
+			const size_type max = this->max_size();
+			if (n > max)
+				throw std::length_error("ft::mapped_vector");
+			if (this->_capacity >= max / 2)
+				return max;
+			return ft::max<size_type>(this->_capacity * 2, n);
+		}
+
+		void _close()
+		{
+			if (this->_fd == -1)
+				return;
+			if (this->_start != NULL)
+				munmap(static_cast<void *>(this->_start), this->_capacity * sizeof(value_type));
+			// Nothing to report from a destructor, a failed trim only leaves zeroed records past the end
+			if (ftruncate(this->_fd, static_cast<off_t>(this->_size * sizeof(value_type))) == -1) { }
+			::close(this->_fd);
+			this->_fd = -1;
+			this->_start = NULL;
+			this->_size = 0;
+			this->_capacity = 0;
+		}
+
+		mapped_vector(const mapped_vector &);
+
+		mapped_vector &operator=(const mapped_vector &);
+
+		/* Constructors */
+	public:
+		/**
+		 * Maps the file at 'path', creating it empty if it does not exist
+		 * @throws std::runtime_error if the file cannot be opened or mapped, or if its size is not a whole
+		 * number of records
+		 */
+		explicit mapped_vector(const char *path) : _fd(-1), _start(NULL), _size(0), _capacity(0)
+		{
+			this->_fd = ::open(path, O_RDWR | O_CREAT, 0644);
+			if (this->_fd == -1)
+				_throw_errno(path);
+			struct stat st;
+			if (fstat(this->_fd, &st) == -1)
+			{
+				const int err = errno;
+				::close(this->_fd);
+				errno = err;
+				_throw_errno(path);
+			}
+			const size_type bytes = static_cast<size_type>(st.st_size);
+			if (bytes % sizeof(value_type) != 0)
+			{
+				::close(this->_fd);
+				throw std::runtime_error(std::string("ft::mapped_vector: ") + path +
+										 ": size is not a multiple of the record size");
+			}
+			if (bytes == 0)
+				return;
+			void *p = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, this->_fd, 0);
+			if (p == MAP_FAILED)
+			{
+				const int err = errno;
+				::close(this->_fd);
+				errno = err;
+				_throw_errno(path);
+			}
+			this->_start = static_cast<pointer>(p);
+			this->_size = this->_capacity = bytes / sizeof(value_type);
+		}
+
+#if FT_CXX11
+		/* Move Constructor, takes over the file of 'x' and leaves it closed */
+		mapped_vector(mapped_vector &&x) noexcept : _fd(-1), _start(NULL), _size(0), _capacity(0)
+		{
+			this->swap(x);
+		}
+#endif
+
+		/* Destructors */
+	public:
+		/* Unmaps the file and trims it to its records */
+		~mapped_vector() { this->_close(); }
+
+		/* Public Member Functions */
+	public:
+#if FT_CXX11
+		mapped_vector &operator=(mapped_vector &&x) noexcept
+		{
+			if (this == &x)
+				return *this;
+
+			this->_close();
+			this->swap(x);
+			return *this;
+		}
+#endif
+
+		/* Iterator functions */
+	public:
+		iterator begin() { return iterator(this->_start); }
+
+		const_iterator begin() const { return const_iterator(this->_start); }
+
+		iterator end() { return iterator(this->_start + this->_size); }
+
+		const_iterator end() const { return const_iterator(this->_start + this->_size); }
+
+		reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+
+		reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+		const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+		/* Capacity functions */
+	public:
+		size_type size() const { return this->_size; }
+
+		size_type max_size() const
+		{
+			return ft::min<size_type>(std::numeric_limits<off_t>::max() / sizeof(value_type),
+									  std::numeric_limits<difference_type>::max() / sizeof(value_type));
+		}
+
+		size_type capacity() const { return this->_capacity; }
+
+		bool empty() const { return this->_size == 0; }
+
+		/* Extends the file and its mapping to hold 'n' records, the new ones read as zero bytes */
+		void reserve(size_type n)
+		{
+			if (n <= this->_capacity)
+				return;
+			if (n > this->max_size())
+				throw std::length_error("ft::mapped_vector::reserve");
+			this->_remap(n);
+		}
+
+		void resize(size_type n, value_type val = value_type())
+		{
+			if (n > this->_capacity)
+				this->reserve(this->_recommend_capacity(n));
+			for (size_type i = this->_size; i < n; ++i)
+				this->_start[ i ] = val;
+			this->_size = n;
+		}
+
+		/* Element access functions */
+	public:
+		reference operator[](size_type n) { return this->_start[ n ]; }
+
+		const_reference operator[](size_type n) const { return this->_start[ n ]; }
+
+		reference at(size_type n)
+		{
+			if (n >= this->_size)
+				throw std::out_of_range("ft::mapped_vector::at");
+			return this->_start[ n ];
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= this->_size)
+				throw std::out_of_range("ft::mapped_vector::at");
+			return this->_start[ n ];
+		}
+
+		reference front() { return this->_start[ 0 ]; }
+
+		const_reference front() const { return this->_start[ 0 ]; }
+
+		reference back() { return this->_start[ this->_size - 1 ]; }
+
+		const_reference back() const { return this->_start[ this->_size - 1 ]; }
+
+		pointer data() { return this->_start; }
+
+		const_pointer data() const { return this->_start; }
+
+		/* Modifiers functions */
+	public:
+		/* 'val' is copied first, as growing may move the mapping it lives in */
+		void push_back(const value_type &val)
+		{
+			if (this->_size == this->_capacity)
+			{
+				const value_type tmp = val;
+				this->_remap(this->_recommend_capacity(this->_size + 1));
+				this->_start[ this->_size++ ] = tmp;
+				return;
+			}
+			this->_start[ this->_size++ ] = val;
+		}
+
+		void pop_back() { --this->_size; }
+
+		void clear() { this->_size = 0; }
+
+		/**
+		 * Writes the modified pages back to the file
+		 * @throws std::runtime_error if the write fails
+		 */
+		void flush()
+		{
+			if (this->_start != NULL &&
+				msync(static_cast<void *>(this->_start), this->_capacity * sizeof(value_type), MS_SYNC) == -1)
+				_throw_errno("msync");
+		}
+
+		void swap(mapped_vector &x)
+		{
+			std::swap(this->_fd, x._fd);
+			std::swap(this->_start, x._start);
+			std::swap(this->_size, x._size);
+			std::swap(this->_capacity, x._capacity);
+		}
+	};
+
+	/* Relational Operators Overload */
+	template < class T >
+	bool operator==(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs)
+	{
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template < class T >
+	bool operator!=(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs) { return !(lhs == rhs); }
+
+	template < class T >
+	bool operator<(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs)
+	{
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template < class T >
+	bool operator<=(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs) { return !(rhs < lhs); }
+
+	template < class T >
+	bool operator>(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs) { return rhs < lhs; }
+
+	template < class T >
+	bool operator>=(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs) { return !(lhs < rhs); }
+
+	/* Swap */
+	template < class T >
+	void swap(mapped_vector<T> &x, mapped_vector<T> &y) { x.swap(y); }
+
+} // namespace ft
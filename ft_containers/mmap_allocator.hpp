@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <limits>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "type_traits/type_traits.hpp"
+#include "utility/compiler.hpp"
+#include "utility/move.hpp"
+
+namespace ft
+{
+	/**
+	 * Allocator mapping each buffer directly from the kernel, for very large containers
+	 * @details Buffers are rounded up to whole pages, and those of 2 MiB or more are advised to be backed
+	 * by transparent huge pages. On Linux, 'reallocate' grows a buffer with 'mremap', which moves page
+	 * table entries instead of copying bytes, so a container of trivially relocatable elements can grow
+	 * without ever holding both the old and the new buffer. Small buffers waste most of their page, so
+	 * this only pays off for containers of megabytes.
+	 */
+	template < class T >
+	class mmap_allocator
+	{
+		/* Member Types */
+	public:
+		typedef T value_type;
+		typedef value_type *pointer;
+		typedef const value_type *const_pointer;
+		typedef value_type &reference;
+		typedef const value_type &const_reference;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+
+		template < class U >
+		struct rebind
+		{
+			typedef mmap_allocator<U> other;
+		};
+
+		/* Buffers at least this large get the huge page hint */
+		static const size_type huge_page_threshold = 2 * 1024 * 1024;
+
+		/* Private Functions */
+	private:
+		/* Size of the mapping holding 'n' elements, at least one page so that empty buffers are valid */
+		static size_type _mapping_size(size_type n)
+		{
+			const size_type page = static_cast<size_type>(sysconf(_SC_PAGESIZE));
+			const size_type bytes = n * sizeof(value_type);
+			return bytes == 0 ? page : (bytes + page - 1) / page * page;
+		}
+
+		static void _advise(void *p, size_type bytes)
+		{
+#ifdef MADV_HUGEPAGE
+			if (bytes >= huge_page_threshold)
+				madvise(p, bytes, MADV_HUGEPAGE);
+#else
+			(void) p;
+			(void) bytes;
+#endif
+		}
+
+		/* Constructors */
+	public:
+		mmap_allocator() { }
+
+		mmap_allocator(const mmap_allocator &) { }
+
+		template < class U >
+		mmap_allocator(const mmap_allocator<U> &) { }
+
+		/* Public Member Functions */
+	public:
+		pointer address(reference x) const { return &x; }
+
+		const_pointer address(const_reference x) const { return &x; }
+
+		pointer allocate(size_type n, const void * = 0)
+		{
+			if (n > this->max_size())
+				throw std::bad_alloc();
+			const size_type bytes = _mapping_size(n);
+			void *p = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (p == MAP_FAILED)
+				throw std::bad_alloc();
+			_advise(p, bytes);
+			return static_cast<pointer>(p);
+		}
+
+		void deallocate(pointer p, size_type n)
+		{
+			munmap(static_cast<void *>(p), _mapping_size(n));
+		}
+
+		/**
+		 * Grows or shrinks the buffer 'p' of 'old_n' elements to 'new_n' elements, keeping its bytes
+		 * @details Uses 'mremap' on Linux, which extends the mapping in place when the following addresses
+		 * are free and otherwise moves its pages. Elsewhere, maps a new buffer and copies the bytes.
+		 * @return The buffer, possibly at another address, in which case 'p' is no longer valid
+		 * @throws std::bad_alloc, 'p' is then left untouched
+		 */
+		pointer reallocate(pointer p, size_type old_n, size_type new_n)
+		{
+			if (new_n > this->max_size())
+				throw std::bad_alloc();
+			const size_type old_bytes = _mapping_size(old_n);
+			const size_type new_bytes = _mapping_size(new_n);
+			if (old_bytes == new_bytes)
+				return p;
+#ifdef MREMAP_MAYMOVE
+			void *q = mremap(static_cast<void *>(p), old_bytes, new_bytes, MREMAP_MAYMOVE);
+			if (q == MAP_FAILED)
+				throw std::bad_alloc();
+			_advise(q, new_bytes);
+			return static_cast<pointer>(q);
+#else
+			pointer q = this->allocate(new_n);
+			std::memcpy(static_cast<void *>(q), static_cast<const void *>(p),
+						(old_bytes < new_bytes ? old_bytes : new_bytes));
+			this->deallocate(p, old_n);
+			return q;
+#endif
+		}
+
+		size_type max_size() const { return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2; }
+
+		void construct(pointer p, const_reference val) { new(static_cast<void *>(p)) value_type(val); }
+
+#if FT_CXX11
+		template < class U, class... Args >
+		void construct(U *p, Args &&...args) { new(static_cast<void *>(p)) U(ft::forward<Args>(args)...); }
+#endif
+
+		void destroy(pointer p) { p->~value_type(); }
+	};
+
+	template < class T >
+	const typename mmap_allocator<T>::size_type mmap_allocator<T>::huge_page_threshold;
+
+	template < class T >
+	struct allocator_can_reallocate<ft::mmap_allocator<T> > : public true_type { };
+
+	/* Buffers are independent mappings, any instance can release any other's */
+	template < class T, class U >
+	bool operator==(const mmap_allocator<T> &, const mmap_allocator<U> &) { return true; }
+
+	template < class T, class U >
+	bool operator!=(const mmap_allocator<T> &, const mmap_allocator<U> &) { return false; }
+
+} // namespace ft
@@ -0,0 +1,320 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include "utility/pair.hpp"
+#include "iterator/reverse_iterator.hpp"
+#include "iterator/iterator_traits.hpp"
+#include "iterator/iterator_utils.hpp"
+#include "red_black_tree/red_black_tree.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/lexicographical_compare.hpp"
+#include "map.hpp"
+
+namespace ft
+{
+	/**
+	 * Ordered associative container allowing several elements with equivalent keys
+	 * @details Shares tree and iterator types with 'ft::map'. The tree inserts equivalent keys to the
+	 * right of existing ones, so elements with equal keys keep their insertion order.
+	 */
+	template < class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> > >
+	class multimap
+	{
+		/* Member Types */
+	private:
+		typedef ft::map<Key, T, Compare, Alloc> map_type;
+	public:
+		/* Value Types */
+		typedef Key key_type;
+		typedef T mapped_type;
+		typedef ft::pair<const key_type, mapped_type> value_type;
+		typedef Compare key_compare;
+		typedef typename map_type::value_compare value_compare;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+		/* Tree Types */
+		typedef typename map_type::tree_type tree_type;
+		typedef typename tree_type::iterator tree_iterator;
+		typedef typename tree_type::const_iterator tree_const_iterator;
+		typedef typename allocator_type::size_type size_type;
+		/* Iterator Types */
+		typedef typename map_type::iterator iterator;
+		typedef typename map_type::const_iterator const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
+
+		/* Private Member */
+	private:
+		key_compare _comp;
+		allocator_type _alloc;
+		tree_type _rbt;
+
+		/* Constructors */
+	public:
+		/* Default Constructor */
+		explicit multimap(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+				: _comp(comp), _alloc(alloc), _rbt() { }
+
+		/* Range Constructor */
+		template < class InputIterator >
+		multimap(InputIterator first, InputIterator last, const key_compare &comp = key_compare(),
+				 const allocator_type &alloc = allocator_type()) : _comp(comp), _alloc(alloc), _rbt()
+		{
+			this->insert(first, last);
+		}
+
+		/* Copy Constructor */
+		multimap(const multimap &x) : _comp(x._comp), _alloc(x._alloc), _rbt(x._rbt) { }
+
+#if FT_CXX11
+		/* Move Constructor */
+		multimap(multimap &&x) : _comp(x._comp), _alloc(x._alloc), _rbt(ft::move(x._rbt)) { }
+#endif
+
+		/* Destructors */
+	public:
+		~multimap() { this->_rbt.clear(); }
+
+		/* Public Member Functions */
+	public:
+		multimap &operator=(const multimap &x)
+		{
+			if (&x == this)
+				return *this;
+
+			this->_rbt = x._rbt;
+			this->_comp = x._comp;
+			this->_alloc = x._alloc;
+			return *this;
+		}
+
+#if FT_CXX11
+		multimap &operator=(multimap &&x)
+		{
+			if (&x == this)
+				return *this;
+
+			this->_rbt = ft::move(x._rbt);
+			this->_comp = x._comp;
+			this->_alloc = x._alloc;
+			return *this;
+		}
+#endif
+
+		/* Iterator functions */
+	public:
+		iterator begin() { return iterator(this->_rbt.begin()); }
+
+		const_iterator begin() const { return const_iterator(this->_rbt.begin()); }
+
+		iterator end() { return iterator(this->_rbt.end()); }
+
+		const_iterator end() const { return const_iterator(this->_rbt.end()); }
+
+		reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+
+		reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+		const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+		/* Capacity functions */
+	public:
+		bool empty() const { return this->_rbt.empty(); }
+
+		size_type size() const { return this->_rbt.size(); }
+
+		size_type max_size() const { return this->_rbt.get_node_allocator().max_size(); }
+
+		/* Modifiers functions */
+	public:
+		/* Insert functions */
+		/* Insert Single Element */
+		iterator insert(const value_type &val) { return iterator(this->_rbt.insert(val)); }
+
+#if FT_CXX11
+		iterator insert(value_type &&val) { return iterator(this->_rbt.insert(ft::move(val))); }
+#endif
+
+		/* Insert With Hint */
+		iterator insert(iterator position, const value_type &val)
+		{
+			( void ) position; // we dont take hints here :D
+			return iterator(this->_rbt.insert(val));
+		}
+
+		/* Insert Range */
+		template < class InputIterator >
+		void insert(InputIterator first, InputIterator last)
+		{
+			for (InputIterator it = first; it != last; ++it)
+				this->_rbt.insert(*it);
+		}
+
+		/* Erase functions */
+		void erase(iterator position)
+		{
+			if (position == this->end())
+				return;
+			this->_rbt.erase(position.base());
+		}
+
+		size_type erase(const key_type &k)
+		{
+			ft::pair<iterator, iterator> range = this->equal_range(k);
+			size_type n = 0;
+			while (range.first != range.second)
+			{
+				this->erase(range.first++);
+				++n;
+			}
+			return n;
+		}
+
+		void erase(iterator first, iterator last)
+		{
+			this->_rbt.erase(first.base(), last.base());
+		}
+
+		/* Swap function */
+		void swap(multimap &x)
+		{
+			this->_rbt.swap(x._rbt);
+			std::swap(this->_comp, x._comp);
+		}
+
+		/* Clear function */
+		void clear() { this->_rbt.clear(); }
+
+		/* Observer functions */
+	public:
+		key_compare key_comp() const { return this->_comp; }
+
+		value_compare value_comp() const { return value_compare(this->_comp); }
+
+		/* Operation functions */
+	private:
+		struct pair_to_key_comp
+		{
+			key_compare comp;
+
+			explicit pair_to_key_comp(const key_compare &c) : comp(c) { }
+
+			bool operator()(const value_type &value, const key_type &key) const { return comp(value.first, key); }
+		};
+
+		struct key_to_pair_comp
+		{
+			key_compare comp;
+
+			explicit key_to_pair_comp(const key_compare &c) : comp(c) { }
+
+			bool operator()(const key_type &key, const value_type &value) const { return comp(key, value.first); }
+		};
+
+	public:
+		/* Find first element with key 'k' */
+		iterator find(const key_type &k)
+		{
+			iterator it = this->lower_bound(k);
+			if (it == this->end() || this->_comp(k, it->first))
+				return this->end();
+			return it;
+		}
+
+		const_iterator find(const key_type &k) const
+		{
+			const_iterator it = this->lower_bound(k);
+			if (it == this->end() || this->_comp(k, it->first))
+				return this->end();
+			return it;
+		}
+
+		size_type count(const key_type &k) const
+		{
+			ft::pair<const_iterator, const_iterator> range = this->equal_range(k);
+			return ft::distance(range.first, range.second);
+		}
+
+		iterator lower_bound(const key_type &k)
+		{
+			return iterator(this->_rbt.lower_bound(k, pair_to_key_comp(this->_comp)));
+		}
+
+		const_iterator lower_bound(const key_type &k) const
+		{
+			return const_iterator(this->_rbt.lower_bound(k, pair_to_key_comp(this->_comp)));
+		}
+
+		iterator upper_bound(const key_type &k)
+		{
+			return iterator(this->_rbt.upper_bound(k, key_to_pair_comp(this->_comp)));
+		}
+
+		const_iterator upper_bound(const key_type &k) const
+		{
+			return const_iterator(this->_rbt.upper_bound(k, key_to_pair_comp(this->_comp)));
+		}
+
+		pair<const_iterator, const_iterator> equal_range(const key_type &k) const
+		{
+			return ft::pair<const_iterator, const_iterator>(this->lower_bound(k), this->upper_bound(k));
+		}
+
+		pair<iterator, iterator> equal_range(const key_type &k)
+		{
+			return ft::pair<iterator, iterator>(this->lower_bound(k), this->upper_bound(k));
+		}
+
+		/* Allocator functions */
+	public:
+		allocator_type get_allocator() const { return this->_alloc; }
+	};
+
+	/* Relational Operators Overload */
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator==(const multimap<Key, T, Compare, Alloc> &lhs, const multimap<Key, T, Compare, Alloc> &rhs)
+	{
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator!=(const multimap<Key, T, Compare, Alloc> &lhs, const multimap<Key, T, Compare, Alloc> &rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator<(const multimap<Key, T, Compare, Alloc> &lhs, const multimap<Key, T, Compare, Alloc> &rhs)
+	{
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator<=(const multimap<Key, T, Compare, Alloc> &lhs, const multimap<Key, T, Compare, Alloc> &rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator>(const multimap<Key, T, Compare, Alloc> &lhs, const multimap<Key, T, Compare, Alloc> &rhs)
+	{
+		return rhs < lhs;
+	}
+
+	template < class Key, class T, class Compare, class Alloc >
+	bool operator>=(const multimap<Key, T, Compare, Alloc> &lhs, const multimap<Key, T, Compare, Alloc> &rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+	/* Swap */
+	template < class Key, class T, class Compare, class Alloc >
+	void swap(multimap<Key, T, Compare, Alloc> &x, multimap<Key, T, Compare, Alloc> &y) { x.swap(y); }
+} // namespace ft
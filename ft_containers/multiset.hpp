@@ -0,0 +1,258 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include "iterator/iterator_traits.hpp"
+#include "iterator/iterator_utils.hpp"
+#include "iterator/reverse_iterator.hpp"
+#include "utility/pair.hpp"
+#include "red_black_tree/red_black_tree.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/lexicographical_compare.hpp"
+
+namespace ft
+{
+	/**
+	 * Ordered container allowing several equivalent values
+	 * @details The tree inserts equivalent values to the right of existing ones, so equal values keep
+	 * their insertion order
+	 */
+	template < class T, class Compare = std::less<T>, class Alloc = std::allocator<T> >
+	class multiset
+	{
+		/* Member Types */
+	public:
+		typedef T key_type;
+		typedef T value_type;
+		typedef Compare key_compare;
+		typedef Compare value_compare;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+	private:
+		typedef ft::red_black_tree<const value_type, value_compare, allocator_type> tree_type;
+		typedef typename tree_type::iterator tree_iterator;
+		typedef typename tree_type::const_iterator tree_const_iterator;
+	public:
+		typedef tree_const_iterator iterator;
+		typedef tree_const_iterator const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
+		typedef size_t size_type;
+
+		/* Private Members */
+	private:
+		value_compare _comp;
+		allocator_type _alloc;
+		tree_type _rbt;
+
+		/* Constructor */
+	public:
+		explicit multiset(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type())
+				: _comp(comp), _alloc(alloc) { }
+
+		template < class InputIterator >
+		multiset(InputIterator first, InputIterator last, const key_compare &comp = key_compare(),
+				 const allocator_type &alloc = allocator_type()) : _comp(comp), _alloc(alloc)
+		{
+			this->insert(first, last);
+		}
+
+		multiset(const multiset &x) : _comp(x._comp), _alloc(x._alloc), _rbt(x._rbt) { }
+
+#if FT_CXX11
+		multiset(multiset &&x) : _comp(x._comp), _alloc(x._alloc), _rbt(ft::move(x._rbt)) { }
+#endif
+
+		/* Destructor */
+	public:
+		~multiset() { this->clear(); }
+
+		/* Public Member Functions */
+	public:
+		multiset &operator=(const multiset &x)
+		{
+			if (this == &x)
+				return *this;
+
+			this->_rbt = x._rbt;
+			this->_comp = x._comp;
+			this->_alloc = x._alloc;
+
+			return *this;
+		}
+
+#if FT_CXX11
+		multiset &operator=(multiset &&x)
+		{
+			if (this == &x)
+				return *this;
+
+			this->_rbt = ft::move(x._rbt);
+			this->_comp = x._comp;
+			this->_alloc = x._alloc;
+
+			return *this;
+		}
+#endif
+
+		/* Iterator Functions */
+	public:
+		iterator begin() const { return iterator(this->_rbt.begin()); }
+
+		iterator end() const { return iterator(this->_rbt.end()); }
+
+		reverse_iterator rbegin() const { return reverse_iterator(this->end()); }
+
+		reverse_iterator rend() const { return reverse_iterator(this->begin()); }
+
+		/* Capacity Functions */
+	public:
+		bool empty() const { return this->_rbt.empty(); }
+
+		size_type size() const { return this->_rbt.size(); }
+
+		size_type max_size() const { return this->_rbt.get_node_allocator().max_size(); }
+
+		/* Modifiers */
+	public:
+		iterator insert(const value_type &val) { return iterator(this->_rbt.insert(val)); }
+
+#if FT_CXX11
+		iterator insert(value_type &&val) { return iterator(this->_rbt.insert(ft::move(val))); }
+#endif
+
+		iterator insert(iterator position, const value_type &val)
+		{
+			( void ) position;
+			return iterator(this->_rbt.insert(val));
+		}
+
+		template < class InputIterator >
+		void insert(InputIterator first, InputIterator last)
+		{
+			for (InputIterator it = first; it != last; ++it)
+				this->_rbt.insert(*it);
+		}
+
+		void erase(iterator position)
+		{
+			if (position == this->end())
+				return;
+
+			this->_rbt.erase(position.get_base_ptr());
+		}
+
+		size_type erase(const value_type &val)
+		{
+			ft::pair<iterator, iterator> range = this->equal_range(val);
+			size_type n = 0;
+			while (range.first != range.second)
+			{
+				this->erase(range.first++);
+				++n;
+			}
+			return n;
+		}
+
+		void erase(iterator first, iterator last)
+		{
+			while (first != last)
+				this->erase(first++);
+		}
+
+		void swap(multiset &x)
+		{
+			this->_rbt.swap(x._rbt);
+			std::swap(this->_comp, x._comp);
+		}
+
+		void clear()
+		{
+			if (this->empty())
+				return;
+			this->_rbt.clear();
+		}
+
+		/* Observers */
+	public:
+		key_compare key_comp() const { return this->_comp; }
+
+		value_compare value_comp() const { return this->_comp; }
+
+		/* Operations */
+	public:
+		/* Find first element equivalent to 'val' */
+		iterator find(const value_type &val) const
+		{
+			iterator it = this->lower_bound(val);
+			if (it == this->end() || this->_comp(val, *it))
+				return this->end();
+			return it;
+		}
+
+		size_type count(const value_type &val) const
+		{
+			ft::pair<iterator, iterator> range = this->equal_range(val);
+			return ft::distance(range.first, range.second);
+		}
+
+		iterator lower_bound(const value_type &val) const
+		{
+			return iterator(this->_rbt.lower_bound(val, this->_comp));
+		}
+
+		iterator upper_bound(const value_type &val) const
+		{
+			return iterator(this->_rbt.upper_bound(val, this->_comp));
+		}
+
+		ft::pair<iterator, iterator> equal_range(const value_type &val) const
+		{
+			return ft::pair<iterator, iterator>(this->lower_bound(val), this->upper_bound(val));
+		}
+
+		/* Allocator Functions */
+	public:
+		allocator_type get_allocator() const { return this->_alloc; }
+
+	};
+
+	/* Relational Operators Overload */
+	template < class Key, class Compare, class Alloc >
+	bool operator==(const ft::multiset<Key, Compare, Alloc> &lhs,
+					const ft::multiset<Key, Compare, Alloc> &rhs)
+	{
+		return ((lhs.size() == rhs.size()) && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template < class Key, class Compare, class Alloc >
+	bool operator!=(const ft::multiset<Key, Compare, Alloc> &lhs,
+					const ft::multiset<Key, Compare, Alloc> &rhs) { return (!(lhs == rhs)); }
+
+	template < class Key, class Compare, class Alloc >
+	bool operator<(const ft::multiset<Key, Compare, Alloc> &lhs,
+				   const ft::multiset<Key, Compare, Alloc> &rhs)
+	{
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template < class Key, class Compare, class Alloc >
+	bool operator<=(const ft::multiset<Key, Compare, Alloc> &lhs,
+					const ft::multiset<Key, Compare, Alloc> &rhs) { return (!(rhs < lhs)); }
+
+	template < class Key, class Compare, class Alloc >
+	bool operator>(const ft::multiset<Key, Compare, Alloc> &lhs,
+				   const ft::multiset<Key, Compare, Alloc> &rhs) { return (rhs < lhs); }
+
+	template < class Key, class Compare, class Alloc >
+	bool operator>=(const ft::multiset<Key, Compare, Alloc> &lhs,
+					const ft::multiset<Key, Compare, Alloc> &rhs) { return (!(lhs < rhs)); }
+
+	/* Swap */
+	template < class T, class Compare, class Alloc >
+	void swap(multiset<T, Compare, Alloc> &x, multiset<T, Compare, Alloc> &y) { x.swap(y); }
+} // namespace ft
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ft
+{
+	/*
+	 * Aggregates are monoids a 'red_black_tree' maintains for every subtree. A model provides
+	 *   typedef ... result_type;
+	 *   result_type identity() const;                                  neutral element
+	 *   result_type operator()(const Value &value) const;              aggregate of a single value
+	 *   result_type combine(const result_type &lhs, const result_type &rhs) const;   associative
+	 * 'combine' is always called with 'lhs' covering smaller values than 'rhs', so it need not commute.
+	 */
+
+	/**
+	 * Default aggregate, disables subtree aggregation entirely
+	 */
+	template < class Value >
+	struct no_aggregate
+	{
+		struct result_type
+		{
+		};
+
+		result_type identity() const { return result_type(); }
+
+		result_type operator()(const Value &) const { return result_type(); }
+
+		result_type combine(const result_type &, const result_type &) const { return result_type(); }
+	};
+
+	/**
+	 * Counts the elements of a subtree, turning the tree into an order-statistic tree
+	 */
+	template < class Value >
+	struct size_aggregate
+	{
+		typedef std::size_t result_type;
+
+		result_type identity() const { return 0; }
+
+		result_type operator()(const Value &) const { return 1; }
+
+		result_type combine(const result_type &lhs, const result_type &rhs) const { return lhs + rhs; }
+	};
+} // namespace ft
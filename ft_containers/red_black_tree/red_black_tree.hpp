@@ -2,12 +2,17 @@
 #pragma once
 
 #include "../iterator/iterator_traits.hpp"
+#include "../utility/prefetch.hpp"
+#include "../utility/move.hpp"
+#include "../type_traits/type_traits.hpp"
+#include "rbt_aggregate.hpp"
 #include <iostream>
 
 namespace ft
 {
 
-	template < class T, class Compare = std::less<T>, class Allocator = std::allocator<T> >
+	template < class T, class Compare = std::less<T>, class Allocator = std::allocator<T>,
+			class Aggregate = ft::no_aggregate<T> >
 	class red_black_tree
 	{
 
@@ -38,6 +43,11 @@ namespace ft
 		typedef rbt_const_iterator const_iterator;
 		typedef ft::reverse_iterator<rbt_iterator> reverse_iterator;
 		typedef ft::reverse_iterator<rbt_const_iterator> const_reverse_iterator;
+		typedef Aggregate aggregate_type;
+		typedef typename aggregate_type::result_type aggregate_result;
+
+		/* Number of keys 'search_batch' advances in lockstep */
+		static const size_type search_batch_size = 16;
 
 		/* Subclasses */
 	private:
@@ -51,20 +61,24 @@ namespace ft
 			rbt_node *right;
 			value_type value;
 			bool is_black;
+			aggregate_result aggregate;
 
 			/* Constructors */
 		public:
-			rbt_node() : parent(nil_node), left(nil_node), right(nil_node), value(value_type()), is_black(bool()) { }
+			rbt_node() : parent(nil_node), left(nil_node), right(nil_node), value(value_type()), is_black(bool()),
+						 aggregate(aggregate_type().identity()) { }
 
 			explicit rbt_node(bool is_black = false) : parent(nil_node), left(nil_node), right(nil_node),
 													   value(value_type()),
-													   is_black(is_black) { }
+													   is_black(is_black), aggregate(aggregate_type().identity()) { }
 
-			explicit rbt_node(value_type val) : parent(nil_node), left(nil_node), right(nil_node), value(val),
-												is_black(false) { }
+			explicit rbt_node(value_type val) : parent(nil_node), left(nil_node), right(nil_node),
+												value(ft::move(val)), is_black(false),
+												aggregate(aggregate_type()(this->value)) { }
 
 			rbt_node(const rbt_node &other)
-					: parent(nil_node), left(nil_node), right(nil_node), value(other.value), is_black(false) { }
+					: parent(nil_node), left(nil_node), right(nil_node), value(other.value), is_black(false),
+					  aggregate(aggregate_type()(other.value)) { }
 
 			/* Public Member Functions */
 		public:
@@ -241,6 +255,10 @@ namespace ft
 		node_pointer _root;
 		size_type _size;
 		value_compare _comp;
+		aggregate_type _agg;
+
+		/* Whether nodes carry an aggregate that has to be maintained */
+		static const bool _is_augmented = !ft::is_same<aggregate_type, ft::no_aggregate<T> >::value;
 
 		/* Constructors */
 	public:
@@ -265,6 +283,17 @@ namespace ft
 				this->insert(*it);
 		}
 
+#if FT_CXX11
+		/* Move Constructor, takes over the nodes of 'other' and leaves it empty */
+		red_black_tree(red_black_tree &&other)
+				: _end_node(_new_node(false)), _root(nil_node), _size(0), _comp(other._comp)
+		{
+			this->_end_node->left = nil_node;
+			++this->_nb_trees;
+			this->swap(other);
+		}
+#endif
+
 		/* Destructors */
 	public:
 		virtual ~red_black_tree()
@@ -290,6 +319,18 @@ namespace ft
 			return *this;
 		}
 
+#if FT_CXX11
+		red_black_tree &operator=(red_black_tree &&other)
+		{
+			if (this == &other)
+				return *this;
+
+			this->clear();
+			this->swap(other);
+			return *this;
+		}
+#endif
+
 		/**
 		 * Prints the Tree to 'os'
 		 * @param os ostream to print tree to ( default std::cout )
@@ -328,6 +369,11 @@ namespace ft
 
 		node_pointer max() const { return this->empty() ? this->_end_node : rb_max(this->_root); }
 
+		node_pointer root() const { return this->empty() ? nil_node : this->_root; }
+
+		/* Sentinel standing in for every missing child, its aggregate is always the identity */
+		static node_pointer nil() { return nil_node; }
+
 		/* Element Access Functions */
 	public:
 
@@ -336,7 +382,7 @@ namespace ft
 		/* Insert Function */
 		iterator insert(value_type value)
 		{
-			node_pointer x = this->_new_node(value);
+			node_pointer x = this->_new_node(ft::move(value));
 			this->_tree_insert(x);
 			++this->_size;
 			this->_end_node->left = this->_root;
@@ -410,7 +456,7 @@ namespace ft
 		node_pointer search(value_type value) const { return this->_search(this->_root, value); }
 
 		template < class Type, class EqualityPredicate, class ComparisonPredicate >
-		iterator search(Type value, EqualityPredicate equal, ComparisonPredicate compares) const
+		iterator search(const Type &value, EqualityPredicate equal, ComparisonPredicate compares) const
 		{
 			node_pointer x = this->_root;
 			while (x != nil_node && !equal(value, x->value))
@@ -418,13 +464,181 @@ namespace ft
 			return x != nil_node ? iterator(x) : iterator(this->_end_node);
 		}
 
+		/**
+		 * Finds the first node whose value does not compare less than 'key'
+		 * @param less Predicate returning true if a stored value orders before 'key'
+		 * @return Iterator to the found node, or 'end()' if every value orders before 'key'
+		 */
+		template < class Type, class ComparisonPredicate >
+		iterator lower_bound(const Type &key, ComparisonPredicate less) const
+		{
+			node_pointer x = this->empty() ? nil_node : this->_root;
+			node_pointer y = this->_end_node;
+			while (x != nil_node)
+			{
+				if (!less(x->value, key))
+				{
+					y = x;
+					x = x->left;
+				}
+				else
+					x = x->right;
+			}
+			return iterator(y);
+		}
+
+		/**
+		 * Finds the first node whose value 'key' compares less than
+		 * @param less Predicate returning true if 'key' orders before a stored value
+		 * @return Iterator to the found node, or 'end()' if no value orders after 'key'
+		 */
+		template < class Type, class ComparisonPredicate >
+		iterator upper_bound(const Type &key, ComparisonPredicate less) const
+		{
+			node_pointer x = this->empty() ? nil_node : this->_root;
+			node_pointer y = this->_end_node;
+			while (x != nil_node)
+			{
+				if (less(key, x->value))
+				{
+					y = x;
+					x = x->left;
+				}
+				else
+					x = x->right;
+			}
+			return iterator(y);
+		}
+
+		/**
+		 * Combines the aggregates of all values 'v' with lo <= v < hi, in ascending order, in O(log n)
+		 * @details Descends to the highest node inside the range, then follows its left spine for the lower
+		 * boundary and its right spine for the upper one, reusing whole-subtree aggregates on the way
+		 * @param less Predicate returning true if a stored value orders before a key
+		 */
+		template < class Type, class ComparisonPredicate >
+		aggregate_result aggregate(const Type &lo, const Type &hi, ComparisonPredicate less) const
+		{
+			node_pointer x = this->empty() ? nil_node : this->_root;
+			while (x != nil_node)
+			{
+				if (less(x->value, lo))
+					x = x->right;
+				else if (!less(x->value, hi))
+					x = x->left;
+				else
+					break;
+			}
+			if (x == nil_node)
+				return this->_agg.identity();
+
+			aggregate_result lower = this->_agg.identity();
+			for (node_pointer y = x->left; y != nil_node;)
+			{
+				if (less(y->value, lo))
+					y = y->right;
+				else
+				{
+					lower = this->_agg.combine(this->_agg.combine(this->_agg(y->value), y->right->aggregate), lower);
+					y = y->left;
+				}
+			}
+			aggregate_result upper = this->_agg.identity();
+			for (node_pointer y = x->right; y != nil_node;)
+			{
+				if (less(y->value, hi))
+				{
+					upper = this->_agg.combine(upper, this->_agg.combine(y->left->aggregate, this->_agg(y->value)));
+					y = y->right;
+				}
+				else
+					y = y->left;
+			}
+			return this->_agg.combine(this->_agg.combine(lower, this->_agg(x->value)), upper);
+		}
+
+		/**
+		 * @return Aggregate of the whole tree
+		 */
+		aggregate_result aggregate() const { return this->empty() ? this->_agg.identity() : this->_root->aggregate; }
+
+		/**
+		 * Recomputes the aggregates depending on the value at 'pos' after it was modified in place
+		 */
+		void update_aggregate(iterator pos) { this->_update_path(pos.get_base_ptr()); }
+
+		/**
+		 * Searches every key in [first, last) and writes one 'Result' per key to 'out'
+		 * @details Keys are resolved in groups of 'search_batch_size', advancing all searches of a group
+		 * one tree level per round and prefetching the next node of each, so the cache misses of
+		 * independent searches overlap instead of being paid one after another. Single-pass input iterators
+		 * cannot be revisited, so their keys are searched one after another.
+		 * @tparam Result Type constructible from 'iterator' written for every key ( 'end()' if not found )
+		 * @return Output iterator past the last written result
+		 */
+		template < class Result, class InputIterator, class OutputIterator, class EqualityPredicate,
+				class ComparisonPredicate >
+		OutputIterator search_batch(InputIterator first, InputIterator last, OutputIterator out,
+									EqualityPredicate equal, ComparisonPredicate compares) const
+		{
+			return this->template _search_batch<Result>(first, last, out, equal, compares,
+														typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
 		/* Allocator Functions */
 	public:
 		node_allocator_type get_node_allocator() const { return this->node_allocator; }
 
 		/* Private Member Functions */
 	private:
-		node_pointer _new_node(value_type value) { return new rbt_node(value); }
+		template < class Result, class InputIterator, class OutputIterator, class EqualityPredicate,
+				class ComparisonPredicate >
+		OutputIterator _search_batch(InputIterator first, InputIterator last, OutputIterator out,
+									 EqualityPredicate equal, ComparisonPredicate compares, ft::input_iterator_tag) const
+		{
+			for (; first != last; ++first, ++out)
+				*out = Result(this->search(*first, equal, compares));
+			return out;
+		}
+
+		/* Each search refers to its key through the iterator, so keys are neither copied nor default constructed */
+		template < class Result, class ForwardIterator, class OutputIterator, class EqualityPredicate,
+				class ComparisonPredicate >
+		OutputIterator _search_batch(ForwardIterator first, ForwardIterator last, OutputIterator out,
+									 EqualityPredicate equal, ComparisonPredicate compares,
+									 ft::forward_iterator_tag) const
+		{
+			ForwardIterator keys[ search_batch_size ];
+			node_pointer nodes[ search_batch_size ];
+			while (first != last)
+			{
+				size_type n = 0;
+				for (; n < search_batch_size && first != last; ++n, ++first)
+				{
+					keys[ n ] = first;
+					nodes[ n ] = this->empty() ? nil_node : this->_root;
+				}
+				for (bool pending = true; pending;)
+				{
+					pending = false;
+					for (size_type i = 0; i < n; ++i)
+					{
+						node_pointer x = nodes[ i ];
+						if (x == nil_node || x == this->_end_node || equal(*keys[ i ], x->value))
+							continue;
+						x = (compares(*keys[ i ], x->value)) ? x->left : x->right;
+						ft::prefetch(x);
+						nodes[ i ] = x;
+						pending = true;
+					}
+				}
+				for (size_type i = 0; i < n; ++i, ++out)
+					*out = Result(nodes[ i ] != nil_node ? iterator(nodes[ i ]) : iterator(this->_end_node));
+			}
+			return out;
+		}
+
+		node_pointer _new_node(value_type value) { return new rbt_node(ft::move(value)); }
 
 		static node_pointer _new_node(bool is_black) { return new rbt_node(is_black); }
 
@@ -459,6 +673,7 @@ namespace ft
 					y->left = node;
 				else
 					y->right = node;
+				this->_update_path(y);
 				this->_tree_insert_fixup(node);
 			}
 		}
@@ -534,6 +749,7 @@ namespace ft
 		{
 			node_pointer x;
 			node_pointer y = z;
+			node_pointer lowest_changed = z->parent;
 			bool was_black = y->is_black;
 			if (z->left == nil_node)
 			{
@@ -550,11 +766,13 @@ namespace ft
 				y = rb_min(z->right);
 				was_black = y->is_black;
 				x = y->right;
+				lowest_changed = y;
 				if (y->parent == z)
 					/* pivot can be _NIL, storing p info for fixup */
 					x->parent = y;
 				else
 				{
+					lowest_changed = y->parent;
 					this->_transplant(y, y->right);
 					y->right = z->right;
 					y->right->parent = y;
@@ -564,6 +782,7 @@ namespace ft
 				y->left->parent = y;
 				y->is_black = z->is_black;
 			}
+			this->_update_path(lowest_changed);
 			--this->_size;
 			if (this->_size > 0)
 			{
@@ -711,6 +930,8 @@ namespace ft
 				x->parent->left = y;
 			y->right = x;
 			x->parent = y;
+			this->_update_aggregate(x);
+			this->_update_aggregate(y);
 		}
 
 		/**
@@ -734,6 +955,8 @@ namespace ft
 				x->parent->right = y;
 			y->left = x;
 			x->parent = y;
+			this->_update_aggregate(x);
+			this->_update_aggregate(y);
 		}
 
 		/**
@@ -753,6 +976,29 @@ namespace ft
 			v->parent = u->parent;
 		}
 
+		/* Aggregate Functions */
+		/**
+		 * Recomputes the aggregate of 'x' from its value and the aggregates of its children
+		 */
+		void _update_aggregate(node_pointer x)
+		{
+			if (!_is_augmented)
+				return;
+			x->aggregate = this->_agg.combine(this->_agg.combine(x->left->aggregate, this->_agg(x->value)),
+											  x->right->aggregate);
+		}
+
+		/**
+		 * Recomputes the aggregates of 'x' and all of its ancestors
+		 */
+		void _update_path(node_pointer x)
+		{
+			if (!_is_augmented)
+				return;
+			for (; x != nil_node && x != this->_end_node; x = x->parent)
+				this->_update_aggregate(x);
+		}
+
 		/* Non Member Functions Overload */
 
 		/**
@@ -867,21 +1113,21 @@ namespace ft
 
 	/* Static Member Initialization */
 
-	template < class Value, class Compare, class Allocator >
-	typename red_black_tree<Value, Compare, Allocator>::node_allocator_type
-			red_black_tree<Value, Compare, Allocator>::node_allocator;
+	template < class Value, class Compare, class Allocator, class Aggregate >
+	typename red_black_tree<Value, Compare, Allocator, Aggregate>::node_allocator_type
+			red_black_tree<Value, Compare, Allocator, Aggregate>::node_allocator;
 
-	template < class Value, class Compare, class Allocator >
-	typename red_black_tree<Value, Compare, Allocator>::value_allocator_type
-			red_black_tree<Value, Compare, Allocator>::value_allocator;
+	template < class Value, class Compare, class Allocator, class Aggregate >
+	typename red_black_tree<Value, Compare, Allocator, Aggregate>::value_allocator_type
+			red_black_tree<Value, Compare, Allocator, Aggregate>::value_allocator;
 
-	template < class Value, class Compare, class Allocator >
-	typename red_black_tree<Value, Compare, Allocator>::node_pointer
-			red_black_tree<Value, Compare, Allocator>::nil_node = _new_node(true);
+	template < class Value, class Compare, class Allocator, class Aggregate >
+	typename red_black_tree<Value, Compare, Allocator, Aggregate>::node_pointer
+			red_black_tree<Value, Compare, Allocator, Aggregate>::nil_node = _new_node(true);
 
-	template < class Value, class Compare, class Allocator >
-	typename red_black_tree<Value, Compare, Allocator>::size_type
-			red_black_tree<Value, Compare, Allocator>::_nb_trees = 0;
+	template < class Value, class Compare, class Allocator, class Aggregate >
+	typename red_black_tree<Value, Compare, Allocator, Aggregate>::size_type
+			red_black_tree<Value, Compare, Allocator, Aggregate>::_nb_trees = 0;
 
 
 }
\ No newline at end of file
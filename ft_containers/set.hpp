@@ -56,6 +56,10 @@ namespace ft
 
 		set(const set &x) : _comp(x._comp), _alloc(x._alloc), _rbt(x._rbt) { }
 
+#if FT_CXX11
+		set(set &&x) : _comp(x._comp), _alloc(x._alloc), _rbt(ft::move(x._rbt)) { }
+#endif
+
 		/* Destructor */
 	public:
 		~set() { this->clear(); }
@@ -74,6 +78,20 @@ namespace ft
 			return *this;
 		}
 
+#if FT_CXX11
+		set &operator=(set &&x)
+		{
+			if (this == &x)
+				return *this;
+
+			this->_rbt = ft::move(x._rbt);
+			this->_comp = x._comp;
+			this->_alloc = x._alloc;
+
+			return *this;
+		}
+#endif
+
 		/* Iterator Functions */
 	public:
 		iterator begin() { return iterator(this->_rbt.begin()); }
@@ -110,6 +128,16 @@ namespace ft
 			return ft::pair<iterator, bool>(iterator(this->_rbt.insert(val)), true);
 		}
 
+#if FT_CXX11
+		ft::pair<iterator, bool> insert(value_type &&val)
+		{
+			iterator it = this->find(val);
+			if (it != this->end())
+				return ft::pair<iterator, bool>(it, false);
+			return ft::pair<iterator, bool>(iterator(this->_rbt.insert(ft::move(val))), true);
+		}
+#endif
+
 		iterator insert(iterator position, const value_type &val)
 		{
 			( void ) position;
@@ -168,6 +196,12 @@ namespace ft
 		value_compare value_comp() const { return this->_comp; }
 
 		/* Operations */
+	private:
+		struct value_equal
+		{
+			bool operator()(const value_type &lhs, const value_type &rhs) const { return lhs == rhs; }
+		};
+
 	public:
 		iterator find(const value_type &val)
 		{
@@ -183,6 +217,19 @@ namespace ft
 			return const_iterator(this->_rbt.search(val));
 		}
 
+		/**
+		 * Looks up every value in [first_val, last_val) and writes one iterator per value to 'out_iterators'
+		 * @details Searches are interleaved in the tree so their cache misses overlap, which pays off
+		 * for large batches against trees that do not fit in cache
+		 * @return Output iterator past the last written iterator
+		 */
+		template < class InputIterator, class OutputIterator >
+		OutputIterator find_batch(InputIterator first_val, InputIterator last_val, OutputIterator out_iterators) const
+		{
+			return this->_rbt.template search_batch<const_iterator>(first_val, last_val, out_iterators,
+																	value_equal(), value_comp());
+		}
+
 		size_type count(const value_type &val) const
 		{
 			if (this->find(val) != this->end())
@@ -0,0 +1,674 @@
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+#include <limits>
+#include "iterator/vector_iterator.hpp"
+#include "iterator/reverse_iterator.hpp"
+#include "type_traits/type_traits.hpp"
+#include "iterator/iterator_utils.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/lexicographical_compare.hpp"
+#include "algorithm/copy.hpp"
+#include "algorithm/min.hpp"
+#include "utility/compiler.hpp"
+#include "utility/move.hpp"
+#include "utility/vector_storage.hpp"
+#include "utility/aligned_buffer.hpp"
+
+namespace ft
+{
+	/**
+	 * Vector keeping up to 'N' elements in inline storage, only allocating once it outgrows them
+	 * @details Offers the interface of 'ft::vector'. Elements stored inline live inside the object itself,
+	 * so swapping or moving a small_vector that has not spilled to the heap moves its elements one by one
+	 * and invalidates iterators to them.
+	 */
+	template < class T, std::size_t N, class Alloc = std::allocator<T> >
+	class small_vector
+	{
+		/* Member Types */
+	public:
+		typedef T value_type;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+		typedef ft::random_access_iterator<value_type, small_vector> iterator;
+		typedef ft::random_access_iterator<const value_type, small_vector> const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
+		typedef typename allocator_type::size_type size_type;
+
+		/* Number of elements held without allocating */
+		static const size_type inline_capacity = N;
+
+		/* Private Members */
+	private:
+		size_type _capacity;
+		allocator_type _alloc;
+		struct content
+		{
+			pointer start;
+			pointer end;
+		} _content;
+		ft::aligned_buffer<value_type, N> _buffer;
+
+		/* Private Functions */
+	private:
+		bool _is_inline() const { return this->_content.start == this->_buffer.data(); }
+
+		/* Points the vector at its empty inline storage */
+		void _init_inline()
+		{
+			this->_content.start = this->_content.end = this->_buffer.data();
+			this->_capacity = N;
+		}
+
+		void _release_heap()
+		{
+			if (!this->_is_inline())
+				this->_alloc.deallocate(this->_content.start, this->_capacity);
+		}
+
+		/* Undoes a constructor that threw after elements or a heap buffer were acquired */
+		void _abort_construction()
+		{
+			ft::_destroy(this->_alloc, this->_content.start, this->_content.end);
+			this->_release_heap();
+		}
+
+		/**
+		 * Takes over the elements of 'x', leaving it empty
+		 * @details A heap buffer changes hands as is, inline elements are moved one by one. This vector must
+		 * be empty.
+		 */
+		void _steal(small_vector &x)
+		{
+			if (x._is_inline())
+			{
+				this->_content.end = ft::_uninitialized_move(this->_alloc, x._content.start, x._content.end,
+															   this->_content.start);
+				x.clear();
+				return;
+			}
+			this->_release_heap();
+			this->_alloc = x._alloc;
+			this->_content.start = x._content.start;
+			this->_content.end = x._content.end;
+			this->_capacity = x._capacity;
+			x._init_inline();
+		}
+
+		/* Relocation Functions */
+		/**
+		 * Moves all elements into 'new_start', leaving a gap of 'n' elements at 'offset', and adopts
+		 * 'new_start' as buffer
+		 * @details The gap must already be constructed by the caller. If moving throws, the gap and
+		 * 'new_start' are released and the vector is unchanged.
+		 */
+		void _adopt_buffer(pointer new_start, size_type new_capacity, size_type offset, size_type n)
+		{
+			const size_type old_size = this->size();
+			try
+			{
+				ft::_relocate_around_gap(this->_alloc, this->_content.start, this->_content.end, new_start, offset, n);
+			}
+			catch (...)
+			{
+				ft::_destroy(this->_alloc, new_start + offset, new_start + offset + n);
+				this->_alloc.deallocate(new_start, new_capacity);
+				throw;
+			}
+			this->_release_heap();
+			this->_content.start = new_start;
+			this->_content.end = new_start + old_size + n;
+			this->_capacity = new_capacity;
+		}
+
+		/**
+		 * Inserts the 'n' elements of [first, last) before 'offset'
+		 * @details Shifts the tail in place when the spare capacity suffices, otherwise moves everything
+		 * to a geometrically grown heap buffer
+		 */
+		template < class ForwardIterator >
+		void _insert_range(size_type offset, ForwardIterator first, ForwardIterator last, size_type n)
+		{
+			if (n == 0)
+				return;
+			if (this->_capacity - this->size() >= n)
+			{
+				ft::_insert_range_in_place(this->_alloc, this->_content.start + offset, this->_content.end,
+										   first, last, n);
+				return;
+			}
+			const size_type new_capacity = this->_recommend_capacity(this->size() + n);
+			pointer new_start = this->_alloc.allocate(new_capacity);
+			try
+			{
+				ft::_uninitialized_copy(this->_alloc, first, last, new_start + offset);
+			}
+			catch (...)
+			{
+				this->_alloc.deallocate(new_start, new_capacity);
+				throw;
+			}
+			this->_adopt_buffer(new_start, new_capacity, offset, n);
+		}
+
+		/* Range Dispatch Functions */
+		template < class InputIterator >
+		void _range_init(InputIterator first, InputIterator last, ft::input_iterator_tag)
+		{
+			for (; first != last; ++first)
+				this->push_back(*first);
+		}
+
+		template < class ForwardIterator >
+		void _range_init(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+		{
+			this->reserve(ft::distance(first, last));
+			this->_content.end = ft::_uninitialized_copy(this->_alloc, first, last, this->_content.start);
+		}
+
+		template < class InputIterator >
+		void _range_assign(InputIterator first, InputIterator last, ft::input_iterator_tag)
+		{
+			this->clear();
+			for (; first != last; ++first)
+				this->push_back(*first);
+		}
+
+		template < class ForwardIterator >
+		void _range_assign(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+		{
+			const size_type n = ft::distance(first, last);
+			if (n > this->_capacity)
+			{
+				if (n > this->max_size())
+					throw std::length_error("ft::small_vector::assign");
+				pointer new_start = this->_alloc.allocate(n);
+				pointer new_end;
+				try
+				{
+					new_end = ft::_uninitialized_copy(this->_alloc, first, last, new_start);
+				}
+				catch (...)
+				{
+					this->_alloc.deallocate(new_start, n);
+					throw;
+				}
+				ft::_destroy(this->_alloc, this->_content.start, this->_content.end);
+				this->_release_heap();
+				this->_content.start = new_start;
+				this->_content.end = new_end;
+				this->_capacity = n;
+			}
+			else if (n <= this->size())
+			{
+				pointer new_end = ft::copy(first, last, this->_content.start);
+				ft::_destroy(this->_alloc, new_end, this->_content.end);
+				this->_content.end = new_end;
+			}
+			else
+			{
+				ForwardIterator mid = first;
+				ft::advance(mid, this->size());
+				ft::copy(first, mid, this->_content.start);
+				this->_content.end = ft::_uninitialized_copy(this->_alloc, mid, last, this->_content.end);
+			}
+		}
+
+		template < class InputIterator >
+		void _range_insert(size_type offset, InputIterator first, InputIterator last, ft::input_iterator_tag)
+		{
+			small_vector vc(first, last);
+			this->_insert_range(offset, vc.begin(), vc.end(), vc.size());
+		}
+
+		template < class ForwardIterator >
+		void _range_insert(size_type offset, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+		{
+			this->_insert_range(offset, first, last, ft::distance(first, last));
+		}
+
+		/* Computes the capacity to grow to so that at least 'n' elements fit */
+		size_type _recommend_capacity(size_type n) const
+		{
+			return ft::_recommend_capacity(this->_capacity, n, this->max_size(), "ft::small_vector");
+		}
+
+		/**
+		 * Slow path of 'push_back': moves the content to a larger heap buffer and appends 'val'
+		 */
+		FT_NOINLINE void _realloc_push_back(const value_type &val)
+		{
+			const size_type n = this->size();
+			const size_type new_capacity = this->_recommend_capacity(n + 1);
+
+			pointer new_start = this->_alloc.allocate(new_capacity);
+			try
+			{
+				this->_alloc.construct(new_start + n, val);
+			}
+			catch (...)
+			{
+				this->_alloc.deallocate(new_start, new_capacity);
+				throw;
+			}
+			this->_adopt_buffer(new_start, new_capacity, n, 1);
+		}
+
+#if FT_CXX11
+		template < class... Args >
+		FT_NOINLINE void _realloc_emplace(size_type offset, Args &&...args)
+		{
+			const size_type new_capacity = this->_recommend_capacity(this->size() + 1);
+
+			pointer new_start = this->_alloc.allocate(new_capacity);
+			try
+			{
+				this->_alloc.construct(new_start + offset, ft::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				this->_alloc.deallocate(new_start, new_capacity);
+				throw;
+			}
+			this->_adopt_buffer(new_start, new_capacity, offset, 1);
+		}
+#endif
+
+		/* Constructors */
+	public:
+		/* Default Constructor */
+		explicit small_vector(const allocator_type &alloc = allocator_type()) : _capacity(N), _alloc(alloc), _content()
+		{
+			this->_init_inline();
+		}
+
+		/* Fill Constructor */
+		explicit small_vector(size_type n, const value_type &val = value_type(),
+							  const allocator_type &alloc = allocator_type()) : _capacity(N), _alloc(alloc), _content()
+		{
+			this->_init_inline();
+			try
+			{
+				this->reserve(n);
+				this->_content.end = ft::_uninitialized_fill(this->_alloc, this->_content.start, n, val);
+			}
+			catch (...)
+			{
+				this->_abort_construction();
+				throw;
+			}
+		}
+
+		/* Range Constructor */
+		template < class InputIterator >
+		small_vector(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type(),
+					 typename ft::enable_if<!ft::is_integral<InputIterator>::value, bool>::type = true)
+				: _capacity(N), _alloc(alloc), _content()
+		{
+			this->_init_inline();
+			try
+			{
+				this->_range_init(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+			}
+			catch (...)
+			{
+				this->_abort_construction();
+				throw;
+			}
+		}
+
+		/* Copy Constructor */
+		small_vector(const small_vector &x) : _capacity(N), _alloc(x._alloc), _content()
+		{
+			this->_init_inline();
+			try
+			{
+				this->reserve(x.size());
+				this->_content.end = ft::_uninitialized_copy(this->_alloc, x._content.start, x._content.end,
+															   this->_content.start);
+			}
+			catch (...)
+			{
+				this->_abort_construction();
+				throw;
+			}
+		}
+
+#if FT_CXX11
+		/* Move Constructor, leaves 'x' empty */
+		small_vector(small_vector &&x) : _capacity(N), _alloc(x._alloc), _content()
+		{
+			this->_init_inline();
+			this->_steal(x);
+		}
+#endif
+
+		/* Destructors */
+	public:
+		~small_vector() { this->_abort_construction(); }
+
+		/* Public Member Functions */
+	public:
+		small_vector &operator=(const small_vector &x)
+		{
+			if (this == &x)
+				return *this;
+
+			if (this->_alloc != x._alloc)
+			{
+				this->clear();
+				this->_release_heap();
+				this->_init_inline();
+			}
+			this->_alloc = x._alloc;
+			this->assign(x.begin(), x.end());
+			return *this;
+		}
+
+#if FT_CXX11
+		small_vector &operator=(small_vector &&x)
+		{
+			if (this == &x)
+				return *this;
+
+			this->clear();
+			this->_steal(x);
+			return *this;
+		}
+#endif
+
+		/* Iterator functions */
+	public:
+		iterator begin() { return iterator(this->_content.start); }
+
+		const_iterator begin() const { return const_iterator(this->_content.start); }
+
+		iterator end() { return iterator(this->_content.end); }
+
+		const_iterator end() const { return const_iterator(this->_content.end); }
+
+		reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+
+		reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+		const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+		/* Capacity functions */
+	public:
+		size_type size() const { return static_cast<size_type>(this->_content.end - this->_content.start); }
+
+		size_type max_size() const
+		{
+			return ft::min<size_type>(this->_alloc.max_size(), std::numeric_limits<difference_type>::max());
+		}
+
+		size_type capacity() const { return this->_capacity; }
+
+		bool empty() const { return this->size() == 0; }
+
+		/* Whether the elements live in the inline storage rather than on the heap */
+		bool is_inline() const { return this->_is_inline(); }
+
+		void resize(size_type n, value_type val = value_type())
+		{
+			if (n > this->max_size())
+				throw std::length_error("ft::small_vector::resize");
+			if (n < this->size())
+			{
+				ft::_destroy(this->_alloc, this->_content.start + n, this->_content.end);
+				this->_content.end = this->_content.start + n;
+				return;
+			}
+			if (n > this->_capacity)
+				this->reserve(this->_recommend_capacity(n));
+			this->_content.end = ft::_uninitialized_fill(this->_alloc, this->_content.end, n - this->size(), val);
+		}
+
+		void reserve(size_type n)
+		{
+			if (n <= this->_capacity)
+				return;
+			if (n > this->max_size())
+				throw std::length_error("ft::small_vector::reserve");
+
+			this->_adopt_buffer(this->_alloc.allocate(n), n, this->size(), 0);
+		}
+
+		/* Element access functions */
+	public:
+		reference operator[](size_type n) { return *(this->_content.start + n); }
+
+		const_reference operator[](size_type n) const { return *(this->_content.start + n); }
+
+		reference at(size_type n)
+		{
+			if (n >= this->size())
+				throw std::out_of_range("ft::small_vector::at");
+			return *(this->_content.start + n);
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= this->size())
+				throw std::out_of_range("ft::small_vector::at");
+			return *(this->_content.start + n);
+		}
+
+		reference front() { return *(this->begin()); }
+
+		const_reference front() const { return *(this->begin()); }
+
+		reference back() { return *(this->end() - 1); }
+
+		const_reference back() const { return *(this->end() - 1); }
+
+		/* Modifiers functions */
+	public:
+		template < class InputIterator >
+		void assign(InputIterator first, InputIterator last,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, bool>::type = true)
+		{
+			this->_range_assign(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		void assign(size_type n, const value_type &val)
+		{
+			const value_type val_copy(val);
+
+			this->clear();
+			this->reserve(n);
+			this->_content.end = ft::_uninitialized_fill(this->_alloc, this->_content.start, n, val_copy);
+		}
+
+		void push_back(const value_type &val)
+		{
+			if (this->_content.end != this->_content.start + this->_capacity)
+			{
+				this->_alloc.construct(this->_content.end, val);
+				++this->_content.end;
+				return;
+			}
+			this->_realloc_push_back(val);
+		}
+
+#if FT_CXX11
+		void push_back(value_type &&val) { this->emplace_back(ft::move(val)); }
+
+		template < class... Args >
+		void emplace_back(Args &&...args)
+		{
+			if (this->_content.end != this->_content.start + this->_capacity)
+			{
+				this->_alloc.construct(this->_content.end, ft::forward<Args>(args)...);
+				++this->_content.end;
+				return;
+			}
+			this->_realloc_emplace(this->size(), ft::forward<Args>(args)...);
+		}
+
+		template < class... Args >
+		iterator emplace(iterator position, Args &&...args)
+		{
+			const size_type offset = position - this->begin();
+			if (this->_content.end == this->_content.start + this->_capacity)
+				this->_realloc_emplace(offset, ft::forward<Args>(args)...);
+			else if (offset == this->size())
+			{
+				this->_alloc.construct(this->_content.end, ft::forward<Args>(args)...);
+				++this->_content.end;
+			}
+			else
+				ft::_emplace_in_place(this->_alloc, this->_content.start + offset, this->_content.end,
+									  value_type(ft::forward<Args>(args)...));
+			return iterator(this->_content.start + offset);
+		}
+#endif
+
+		void pop_back()
+		{
+			--this->_content.end;
+			this->_alloc.destroy(this->_content.end);
+		}
+
+		iterator insert(iterator position, const value_type &val)
+		{
+			size_type dist = ft::distance(this->begin(), position);
+			insert(position, 1, val);
+			return iterator(this->_content.start + dist);
+		}
+
+#if FT_CXX11
+		iterator insert(iterator position, value_type &&val) { return this->emplace(position, ft::move(val)); }
+#endif
+
+		void insert(iterator position, size_type n, const value_type &val)
+		{
+			if (n == 0)
+				return;
+
+			const size_type offset = position - this->begin();
+			if (this->_capacity - this->size() >= n)
+			{
+				ft::_insert_fill_in_place(this->_alloc, this->_content.start + offset, this->_content.end, n, val);
+				return;
+			}
+			const size_type new_capacity = this->_recommend_capacity(this->size() + n);
+			pointer new_start = this->_alloc.allocate(new_capacity);
+			try
+			{
+				ft::_uninitialized_fill(this->_alloc, new_start + offset, n, val);
+			}
+			catch (...)
+			{
+				this->_alloc.deallocate(new_start, new_capacity);
+				throw;
+			}
+			this->_adopt_buffer(new_start, new_capacity, offset, n);
+		}
+
+		template < class InputIterator >
+		void insert(iterator position, InputIterator first, InputIterator last,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, bool>::type = true)
+		{
+			this->_range_insert(position - this->begin(), first, last,
+								typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		iterator erase(iterator position) { return erase(position, position + 1); }
+
+		iterator erase(iterator first, iterator last)
+		{
+			/* Keeps 'first' from being moved onto itself */
+			if (first == last)
+				return first;
+
+			ft::_erase_range(this->_alloc, this->_content.start + (first - this->begin()),
+							 this->_content.start + (last - this->begin()), this->_content.end);
+			return first;
+		}
+
+		/**
+		 * Exchanges the contents of both vectors
+		 * @details Constant time when both are on the heap, otherwise inline elements are moved across
+		 */
+		void swap(small_vector &x)
+		{
+			if (!this->_is_inline() && !x._is_inline())
+			{
+				const content x_content_copy = { x._content.start, x._content.end };
+				const size_type x_capacity = x._capacity;
+				x._content.start = this->_content.start;
+				x._content.end = this->_content.end;
+				x._capacity = this->_capacity;
+				this->_content.start = x_content_copy.start;
+				this->_content.end = x_content_copy.end;
+				this->_capacity = x_capacity;
+				return;
+			}
+			small_vector tmp(ft::move(x));
+			x = ft::move(*this);
+			*this = ft::move(tmp);
+		}
+
+		void clear()
+		{
+			ft::_destroy(this->_alloc, this->_content.start, this->_content.end);
+			this->_content.end = this->_content.start;
+		}
+
+		/* Allocator functions */
+	public:
+		allocator_type get_allocator() const { return this->_alloc; }
+	};
+
+	template < class T, std::size_t N, class Alloc >
+	const typename small_vector<T, N, Alloc>::size_type small_vector<T, N, Alloc>::inline_capacity;
+
+	/* Relational Operators Overload */
+	template < class T, std::size_t N, class Alloc >
+	bool operator==(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+	{
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template < class T, std::size_t N, class Alloc >
+	bool operator!=(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template < class T, std::size_t N, class Alloc >
+	bool operator<(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+	{
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template < class T, std::size_t N, class Alloc >
+	bool operator<=(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+	template < class T, std::size_t N, class Alloc >
+	bool operator>(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs) { return rhs < lhs; }
+
+	template < class T, std::size_t N, class Alloc >
+	bool operator>=(const small_vector<T, N, Alloc> &lhs, const small_vector<T, N, Alloc> &rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+	/* Swap */
+	template < class T, std::size_t N, class Alloc >
+	void swap(small_vector<T, N, Alloc> &x, small_vector<T, N, Alloc> &y) { x.swap(y); }
+
+} // namespace ft
@@ -0,0 +1,586 @@
+#pragma once
+
+#include "utility/compiler.hpp"
+
+#if FT_CXX11
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <limits>
+#include <tuple>
+#include "iterator/vector_iterator.hpp"
+#include "type_traits/type_traits.hpp"
+#include "algorithm/max.hpp"
+#include "algorithm/min.hpp"
+#include "algorithm/move.hpp"
+#include "utility/move.hpp"
+
+namespace ft
+{
+	template < std::size_t... Indices >
+	struct _index_sequence
+	{
+	};
+
+	template < std::size_t N, std::size_t... Indices >
+	struct _make_index_sequence : _make_index_sequence<N - 1, N - 1, Indices...>
+	{
+	};
+
+	template < std::size_t... Indices >
+	struct _make_index_sequence<0, Indices...>
+	{
+		typedef _index_sequence<Indices...> type;
+	};
+
+	template < bool... Values >
+	struct _bool_pack
+	{
+	};
+
+	/* Whether all of 'Values' hold, shifting the pack by one only leaves it unchanged when they all do */
+	template < bool... Values >
+	struct _all_of : is_same<_bool_pack<true, Values...>, _bool_pack<Values..., true> >
+	{
+	};
+
+	/* Container of a column as its iterators see it, so that they convert from mutable to const */
+	template < class T >
+	struct _soa_column
+	{
+		typedef T value_type;
+	};
+
+	/**
+	 * Vector of records stored as a structure of arrays, each field in a contiguous column of its own (C++11 only)
+	 * @details Rows are added, removed and reserved for in all columns at once, but a loop over one field only
+	 * brings that column into the cache. Columns are reached through 'data', or through 'begin' and 'end',
+	 * contiguous iterators that take the 'memmove' and SIMD paths of the algorithms. Rows are reached through
+	 * proxies referring to their fields, like the references of 'vector<bool>'.
+	 */
+	template < class... Fields >
+	class soa_vector
+	{
+		static_assert(sizeof...(Fields) > 0, "ft::soa_vector requires at least one field");
+
+		/* Member Types */
+	public:
+		typedef std::tuple<Fields...> value_type;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+
+		template < std::size_t I >
+		using field_type = typename std::tuple_element<I, value_type>::type;
+
+		template < std::size_t I >
+		using column_iterator = ft::random_access_iterator<field_type<I>, _soa_column<field_type<I> > >;
+
+		template < std::size_t I >
+		using const_column_iterator = ft::random_access_iterator<const field_type<I>, _soa_column<field_type<I> > >;
+
+		static const size_type column_count = sizeof...(Fields);
+
+		/**
+		 * Proxy of a row, referring to its fields in their columns
+		 * @details Assigning to a row assigns its fields, whether from a tuple or from another row
+		 */
+		template < bool Const >
+		class basic_row
+		{
+			friend class soa_vector;
+			template < bool >
+			friend class basic_row;
+
+			/* Member Types */
+		public:
+			typedef typename ft::conditional<Const, const soa_vector, soa_vector>::type vector_type;
+			typedef typename ft::conditional<Const, std::tuple<const Fields &...>, std::tuple<Fields &...> >::type
+					tuple_type;
+
+			template < std::size_t I >
+			using field_reference = typename ft::conditional<Const, const field_type<I> &, field_type<I> &>::type;
+
+			/* Private Members */
+		private:
+			vector_type *_vector;
+			size_type _index;
+
+			/* Private Functions */
+		private:
+			template < std::size_t... Is >
+			tuple_type _tie(_index_sequence<Is...>) const
+			{
+				return tuple_type(std::get<Is>(this->_vector->_columns)[ this->_index ]...);
+			}
+
+			/* Constructors */
+		public:
+			basic_row(vector_type *vector, size_type index) : _vector(vector), _index(index) { }
+
+			basic_row(const basic_row &x) = default;
+
+			/* A const row is made from a mutable one */
+			template < bool OtherConst, class = typename ft::enable_if<Const && !OtherConst>::type >
+			basic_row(const basic_row<OtherConst> &x) : _vector(x._vector), _index(x._index) { }
+
+			/* Member Functions */
+		public:
+			template < std::size_t I >
+			field_reference<I> get() const { return std::get<I>(this->_vector->_columns)[ this->_index ]; }
+
+			/* References to all fields, as 'std::tie' would make them */
+			tuple_type tie() const { return this->_tie(typename _make_index_sequence<sizeof...(Fields)>::type()); }
+
+			/* Copies the fields out of the vector */
+			operator value_type() const { return value_type(this->tie()); }
+
+			basic_row &operator=(const value_type &val)
+			{
+				this->tie() = val;
+				return *this;
+			}
+
+			basic_row &operator=(const basic_row &x)
+			{
+				this->tie() = x.tie();
+				return *this;
+			}
+		};
+
+		typedef basic_row<false> reference;
+		typedef basic_row<true> const_reference;
+
+		/* Private Members */
+	private:
+		typedef std::tuple<Fields *...> columns_type;
+		typedef typename _make_index_sequence<sizeof...(Fields)>::type indices;
+		/* Whether columns are moved to a new buffer, rather than copied so that a throwing copy loses nothing */
+		typedef _all_of<ft::is_nothrow_move_constructible<Fields>::value...> _relocate_by_move;
+
+		columns_type _columns;
+		size_type _size;
+		size_type _capacity;
+
+		/* Private Functions */
+	private:
+		template < class T >
+		static void _destroy(T *first, T *last)
+		{
+			for (; first != last; ++first)
+				first->~T();
+		}
+
+		template < class T >
+		static T &&_transfer_value(T &val, true_type) { return ft::move(val); }
+
+		template < class T >
+		static const T &_transfer_value(T &val, false_type) { return val; }
+
+		/* Allocates a column of 'n' elements for each field from the 'I'th on, releasing them all if one fails */
+		template < std::size_t I >
+		static void _allocate(columns_type &columns, size_type n, true_type)
+		{
+			std::get<I>(columns) = std::allocator<field_type<I> >().allocate(n);
+			try
+			{
+				_allocate<I + 1>(columns, n, bool_constant<(I + 1 < column_count)>());
+			}
+			catch (...)
+			{
+				std::allocator<field_type<I> >().deallocate(std::get<I>(columns), n);
+				throw;
+			}
+		}
+
+		template < std::size_t I >
+		static void _allocate(columns_type &, size_type, false_type)
+		{
+		}
+
+		template < std::size_t... Is >
+		static void _deallocate(const columns_type &columns, size_type n, _index_sequence<Is...>)
+		{
+			if (n == 0)
+				return;
+			const int expand[] = { (std::allocator<Fields>().deallocate(std::get<Is>(columns), n), 0)... };
+			(void)expand;
+		}
+
+		/**
+		 * Constructs the first 'n' rows of 'to' from those of 'from', column by column from the 'I'th on
+		 * @details Moves the elements if 'Move' holds, copies them otherwise. If a construction throws, the
+		 * rows constructed so far in 'to' are destroyed.
+		 */
+		template < std::size_t I, class Move >
+		static void _transfer(const columns_type &from, columns_type &to, size_type n, Move, true_type)
+		{
+			typedef field_type<I> T;
+			T *const src = std::get<I>(from);
+			T *const dst = std::get<I>(to);
+			size_type i = 0;
+			try
+			{
+				for (; i < n; ++i)
+					::new(static_cast<void *>(dst + i)) T(_transfer_value(src[ i ], Move()));
+				_transfer<I + 1>(from, to, n, Move(), bool_constant<(I + 1 < column_count)>());
+			}
+			catch (...)
+			{
+				_destroy(dst, dst + i);
+				throw;
+			}
+		}
+
+		template < std::size_t I, class Move >
+		static void _transfer(const columns_type &, columns_type &, size_type, Move, false_type)
+		{
+		}
+
+		/* Constructs the fields of row 'row' in 'columns' from the 'I'th on, destroying those built if one throws */
+		template < std::size_t I, class Arg, class... Args >
+		static void _construct_row(const columns_type &columns, size_type row, Arg &&arg, Args &&... args)
+		{
+			typedef field_type<I> T;
+			T *const slot = std::get<I>(columns) + row;
+			::new(static_cast<void *>(slot)) T(ft::forward<Arg>(arg));
+			try
+			{
+				_construct_row<I + 1>(columns, row, ft::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				slot->~T();
+				throw;
+			}
+		}
+
+		template < std::size_t I >
+		static void _construct_row(const columns_type &, size_type)
+		{
+		}
+
+		/* Value-initializes the fields of row 'row' from the 'I'th on */
+		template < std::size_t I >
+		void _construct_default_row(size_type row, true_type)
+		{
+			typedef field_type<I> T;
+			T *const slot = std::get<I>(this->_columns) + row;
+			::new(static_cast<void *>(slot)) T();
+			try
+			{
+				this->_construct_default_row<I + 1>(row, bool_constant<(I + 1 < column_count)>());
+			}
+			catch (...)
+			{
+				slot->~T();
+				throw;
+			}
+		}
+
+		template < std::size_t I >
+		void _construct_default_row(size_type, false_type)
+		{
+		}
+
+		template < std::size_t... Is >
+		static void _destroy_rows(const columns_type &columns, size_type first, size_type last,
+								  _index_sequence<Is...>)
+		{
+			const int expand[] = { (_destroy(std::get<Is>(columns) + first, std::get<Is>(columns) + last), 0)... };
+			(void)expand;
+		}
+
+		void _destroy_rows(size_type first, size_type last)
+		{
+			_destroy_rows(this->_columns, first, last, indices());
+		}
+
+		/* Moves the rows past 'last' down to 'first' in every column, a 'memmove' for trivially copyable fields */
+		template < std::size_t... Is >
+		void _shift_rows_down(size_type first, size_type last, _index_sequence<Is...>)
+		{
+			const int expand[] = { (ft::move(std::get<Is>(this->_columns) + last,
+											 std::get<Is>(this->_columns) + this->_size,
+											 std::get<Is>(this->_columns) + first), 0)... };
+			(void)expand;
+		}
+
+		/* Moves all rows to new columns of 'n' elements */
+		void _reallocate(size_type n)
+		{
+			columns_type columns;
+			_allocate<0>(columns, n, true_type());
+			try
+			{
+				_transfer<0>(this->_columns, columns, this->_size, _relocate_by_move(), true_type());
+			}
+			catch (...)
+			{
+				_deallocate(columns, n, indices());
+				throw;
+			}
+			this->_destroy_rows(0, this->_size);
+			_deallocate(this->_columns, this->_capacity, indices());
+			this->_columns = columns;
+			this->_capacity = n;
+		}
+
+		/**
+		 * Moves all rows to new columns of 'n' elements, past which it constructs a row from 'args'
+		 * @details The row is constructed first, while the fields of this vector the arguments may refer to
+		 * are still in place
+		 */
+		template < class... Args >
+		void _reallocate_append(size_type n, Args &&... args)
+		{
+			columns_type columns;
+			_allocate<0>(columns, n, true_type());
+			try
+			{
+				_construct_row<0>(columns, this->_size, ft::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				_deallocate(columns, n, indices());
+				throw;
+			}
+			try
+			{
+				_transfer<0>(this->_columns, columns, this->_size, _relocate_by_move(), true_type());
+			}
+			catch (...)
+			{
+				_destroy_rows(columns, this->_size, this->_size + 1, indices());
+				_deallocate(columns, n, indices());
+				throw;
+			}
+			this->_destroy_rows(0, this->_size);
+			_deallocate(this->_columns, this->_capacity, indices());
+			this->_columns = columns;
+			this->_capacity = n;
+		}
+
+		/* Computes the capacity to grow to so that at least 'n' rows fit, doubling like 'ft::vector' */
+		size_type _recommend_capacity(size_type n) const
+		{
+			const size_type max = this->max_size();
+			if (n > max)
+				throw std::length_error("ft::soa_vector");
+			if (this->_capacity >= max / 2)
+				return max;
+			return ft::max<size_type>(this->_capacity * 2, n);
+		}
+
+		/* Constructors */
+	public:
+		/* Default Constructor */
+		soa_vector() : _columns(), _size(0), _capacity(0) { }
+
+		/* Fill Constructor, 'n' value-initialized rows */
+		explicit soa_vector(size_type n) : _columns(), _size(0), _capacity(0) { this->resize(n); }
+
+		/* Copy Constructor */
+		soa_vector(const soa_vector &x) : _columns(), _size(0), _capacity(0)
+		{
+			if (x._size == 0)
+				return;
+			_allocate<0>(this->_columns, x._size, true_type());
+			try
+			{
+				_transfer<0>(x._columns, this->_columns, x._size, false_type(), true_type());
+			}
+			catch (...)
+			{
+				_deallocate(this->_columns, x._size, indices());
+				throw;
+			}
+			this->_size = x._size;
+			this->_capacity = x._size;
+		}
+
+		/* Move Constructor, takes over the columns of 'x' and leaves it empty */
+		soa_vector(soa_vector &&x) noexcept : _columns(), _size(0), _capacity(0) { this->swap(x); }
+
+		/* Destructors */
+	public:
+		~soa_vector()
+		{
+			this->_destroy_rows(0, this->_size);
+			_deallocate(this->_columns, this->_capacity, indices());
+		}
+
+		/* Public Member Functions */
+	public:
+		soa_vector &operator=(const soa_vector &x)
+		{
+			if (this != &x)
+			{
+				soa_vector copy(x);
+				this->swap(copy);
+			}
+			return *this;
+		}
+
+		soa_vector &operator=(soa_vector &&x) noexcept
+		{
+			soa_vector tmp(ft::move(x));
+			this->swap(tmp);
+			return *this;
+		}
+
+		/* Column functions */
+	public:
+		template < std::size_t I >
+		field_type<I> *data() { return std::get<I>(this->_columns); }
+
+		template < std::size_t I >
+		const field_type<I> *data() const { return std::get<I>(this->_columns); }
+
+		template < std::size_t I >
+		column_iterator<I> begin() { return column_iterator<I>(this->data<I>()); }
+
+		template < std::size_t I >
+		const_column_iterator<I> begin() const { return const_column_iterator<I>(this->data<I>()); }
+
+		template < std::size_t I >
+		column_iterator<I> end() { return column_iterator<I>(this->data<I>() + this->_size); }
+
+		template < std::size_t I >
+		const_column_iterator<I> end() const { return const_column_iterator<I>(this->data<I>() + this->_size); }
+
+		/* Capacity functions */
+	public:
+		size_type size() const { return this->_size; }
+
+		size_type max_size() const
+		{
+			return ft::min<size_type>(std::numeric_limits<difference_type>::max(),
+									  std::numeric_limits<size_type>::max() / sizeof(value_type));
+		}
+
+		size_type capacity() const { return this->_capacity; }
+
+		bool empty() const { return this->_size == 0; }
+
+		void reserve(size_type n)
+		{
+			if (n > this->max_size())
+				throw std::length_error("ft::soa_vector::reserve");
+			if (n > this->_capacity)
+				this->_reallocate(n);
+		}
+
+		/* Value-initializes the rows added */
+		void resize(size_type n)
+		{
+			if (n < this->_size)
+			{
+				this->_destroy_rows(n, this->_size);
+				this->_size = n;
+				return;
+			}
+			if (n > this->_capacity)
+				this->_reallocate(this->_recommend_capacity(n));
+			for (; this->_size < n; ++this->_size)
+				this->_construct_default_row<0>(this->_size, true_type());
+		}
+
+		/* Element access functions */
+	public:
+		reference operator[](size_type n) { return reference(this, n); }
+
+		const_reference operator[](size_type n) const { return const_reference(this, n); }
+
+		reference at(size_type n)
+		{
+			if (n >= this->_size)
+				throw std::out_of_range("ft::soa_vector::at");
+			return reference(this, n);
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= this->_size)
+				throw std::out_of_range("ft::soa_vector::at");
+			return const_reference(this, n);
+		}
+
+		reference front() { return reference(this, 0); }
+
+		const_reference front() const { return const_reference(this, 0); }
+
+		reference back() { return reference(this, this->_size - 1); }
+
+		const_reference back() const { return const_reference(this, this->_size - 1); }
+
+		/* Modifiers functions */
+	public:
+		/**
+		 * Appends a row, constructing each field from the argument at its position
+		 * @details The arguments may refer to fields of this vector, also when the columns grow
+		 */
+		template < class... Args >
+		void push_back(Args &&... args)
+		{
+			static_assert(sizeof...(Args) == sizeof...(Fields), "ft::soa_vector::push_back takes one value per field");
+			if (this->_size == this->_capacity)
+				this->_reallocate_append(this->_recommend_capacity(this->_size + 1), ft::forward<Args>(args)...);
+			else
+				_construct_row<0>(this->_columns, this->_size, ft::forward<Args>(args)...);
+			++this->_size;
+		}
+
+		void pop_back()
+		{
+			--this->_size;
+			this->_destroy_rows(this->_size, this->_size + 1);
+		}
+
+		/**
+		 * Removes the rows [first, last), moving the following ones down in every column
+		 * @return Index of the row following the last one removed
+		 */
+		size_type erase(size_type first, size_type last)
+		{
+			if (first == last)
+				return first;
+			this->_shift_rows_down(first, last, indices());
+			const size_type new_size = this->_size - (last - first);
+			this->_destroy_rows(new_size, this->_size);
+			this->_size = new_size;
+			return first;
+		}
+
+		size_type erase(size_type pos) { return this->erase(pos, pos + 1); }
+
+		void clear()
+		{
+			this->_destroy_rows(0, this->_size);
+			this->_size = 0;
+		}
+
+		void swap(soa_vector &x)
+		{
+			const columns_type x_columns = x._columns;
+			const size_type x_size = x._size;
+			const size_type x_capacity = x._capacity;
+			x._columns = this->_columns;
+			x._size = this->_size;
+			x._capacity = this->_capacity;
+			this->_columns = x_columns;
+			this->_size = x_size;
+			this->_capacity = x_capacity;
+		}
+	};
+
+	template < class... Fields >
+	const typename soa_vector<Fields...>::size_type soa_vector<Fields...>::column_count;
+
+	/* Swap */
+	template < class... Fields >
+	void swap(soa_vector<Fields...> &x, soa_vector<Fields...> &y) { x.swap(y); }
+} // namespace ft
+
+#endif
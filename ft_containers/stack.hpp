@@ -44,6 +44,10 @@ namespace ft
 	public:
 		void push(const value_type &val) { this->_container.push_back(val); }
 
+#if FT_CXX11
+		void push(value_type &&val) { this->_container.push_back(ft::move(val)); }
+#endif
+
 		void pop() { this->_container.pop_back(); }
 
 		/* Friend declarations */
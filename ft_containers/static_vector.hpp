@@ -0,0 +1,470 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <algorithm>
+#include "iterator/vector_iterator.hpp"
+#include "iterator/reverse_iterator.hpp"
+#include "type_traits/type_traits.hpp"
+#include "iterator/iterator_utils.hpp"
+#include "algorithm/equal.hpp"
+#include "algorithm/lexicographical_compare.hpp"
+#include "algorithm/copy.hpp"
+#include "algorithm/min.hpp"
+#include "utility/compiler.hpp"
+#include "utility/move.hpp"
+#include "utility/vector_storage.hpp"
+#include "utility/aligned_buffer.hpp"
+
+namespace ft
+{
+	/**
+	 * Vector whose elements always live in inline storage for at most 'N' of them
+	 * @details Never allocates: growing past 'N' elements throws 'std::length_error' and leaves the vector
+	 * unchanged. Offers the interface of 'ft::vector' without allocator, so it can back an 'ft::stack'.
+	 */
+	template < class T, std::size_t N >
+	class static_vector
+	{
+		/* Member Types */
+	public:
+		typedef T value_type;
+		typedef value_type &reference;
+		typedef const value_type &const_reference;
+		typedef value_type *pointer;
+		typedef const value_type *const_pointer;
+		typedef ft::random_access_iterator<value_type, static_vector> iterator;
+		typedef ft::random_access_iterator<const value_type, static_vector> const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
+		typedef std::size_t size_type;
+
+		/* Private Members */
+	private:
+		size_type _size;
+		ft::aligned_buffer<value_type, N> _buffer;
+		static ft::_in_place_allocator<value_type> _alloc;
+
+		/* Private Functions */
+	private:
+		pointer _start() { return this->_buffer.data(); }
+
+		const_pointer _start() const { return this->_buffer.data(); }
+
+		pointer _end() { return this->_buffer.data() + this->_size; }
+
+		/**
+		 * End of the elements as a pointer, for the shared storage operations moving it as they go
+		 * @details Stores it back as the size when going out of scope, also when the operation throws
+		 */
+		struct _size_guard
+		{
+			static_vector &owner;
+			pointer end;
+
+			explicit _size_guard(static_vector &v) : owner(v), end(v._end()) { }
+
+			~_size_guard() { owner._size = end - owner._start(); }
+		};
+
+		/* Throws unless 'n' more elements fit */
+		void _check_room(size_type n, const char *what) const
+		{
+			if (n > N - this->_size)
+				throw std::length_error(what);
+		}
+
+		/* Brings [middle, last) in front of [first, middle) */
+		static void _rotate(pointer first, pointer middle, pointer last)
+		{
+			std::reverse(first, middle);
+			std::reverse(middle, last);
+			std::reverse(first, last);
+		}
+
+		/* Range Dispatch Functions */
+		template < class InputIterator >
+		void _range_assign(InputIterator first, InputIterator last, ft::input_iterator_tag)
+		{
+			this->clear();
+			for (; first != last; ++first)
+				this->push_back(*first);
+		}
+
+		template < class ForwardIterator >
+		void _range_assign(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+		{
+			const size_type n = ft::distance(first, last);
+			if (n > N)
+				throw std::length_error("ft::static_vector::assign");
+			if (n <= this->_size)
+			{
+				pointer new_end = ft::copy(first, last, this->_start());
+				ft::_destroy(this->_alloc, new_end, this->_end());
+				this->_size = n;
+			}
+			else
+			{
+				ForwardIterator mid = first;
+				ft::advance(mid, this->_size);
+				ft::copy(first, mid, this->_start());
+				this->_size = ft::_uninitialized_copy(this->_alloc, mid, last, this->_end()) - this->_start();
+			}
+		}
+
+		/* Single pass ranges are appended and then rotated into place, as their length is unknown */
+		template < class InputIterator >
+		void _range_insert(size_type offset, InputIterator first, InputIterator last, ft::input_iterator_tag)
+		{
+			const size_type old_size = this->_size;
+			try
+			{
+				for (; first != last; ++first)
+					this->push_back(*first);
+			}
+			catch (...)
+			{
+				ft::_destroy(this->_alloc, this->_start() + old_size, this->_end());
+				this->_size = old_size;
+				throw;
+			}
+			_rotate(this->_start() + offset, this->_start() + old_size, this->_end());
+		}
+
+		template < class ForwardIterator >
+		void _range_insert(size_type offset, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+		{
+			const size_type n = ft::distance(first, last);
+			if (n == 0)
+				return;
+			this->_check_room(n, "ft::static_vector::insert");
+			_size_guard guard(*this);
+			ft::_insert_range_in_place(this->_alloc, this->_start() + offset, guard.end, first, last, n);
+		}
+
+		/* Constructors */
+	public:
+		/* Default Constructor */
+		static_vector() : _size(0) { }
+
+		/* Fill Constructor */
+		explicit static_vector(size_type n, const value_type &val = value_type()) : _size(0)
+		{
+			this->_check_room(n, "ft::static_vector");
+			this->_size = ft::_uninitialized_fill(this->_alloc, this->_start(), n, val) - this->_start();
+		}
+
+		/* Range Constructor */
+		template < class InputIterator >
+		static_vector(InputIterator first, InputIterator last,
+					  typename ft::enable_if<!ft::is_integral<InputIterator>::value, bool>::type = true) : _size(0)
+		{
+			try
+			{
+				this->assign(first, last);
+			}
+			catch (...)
+			{
+				this->clear();
+				throw;
+			}
+		}
+
+		/* Copy Constructor */
+		static_vector(const static_vector &x) : _size(0)
+		{
+			this->_size = ft::_uninitialized_copy(this->_alloc, x.begin(), x.end(), this->_start()) - this->_start();
+		}
+
+#if FT_CXX11
+		/* Move Constructor, moves the elements of 'x' one by one */
+		static_vector(static_vector &&x) : _size(0)
+		{
+			this->_size = ft::_uninitialized_move(this->_alloc, x._start(), x._end(), this->_start()) - this->_start();
+		}
+#endif
+
+		/* Destructors */
+	public:
+		~static_vector() { this->clear(); }
+
+		/* Public Member Functions */
+	public:
+		static_vector &operator=(const static_vector &x)
+		{
+			if (this == &x)
+				return *this;
+
+			this->assign(x.begin(), x.end());
+			return *this;
+		}
+
+#if FT_CXX11
+		static_vector &operator=(static_vector &&x)
+		{
+			if (this == &x)
+				return *this;
+
+			const size_type common = ft::min(this->_size, x._size);
+			ft::move(x._start(), x._start() + common, this->_start());
+			if (this->_size > common)
+			{
+				ft::_destroy(this->_alloc, this->_start() + common, this->_end());
+				this->_size = common;
+			}
+			else
+				this->_size = ft::_uninitialized_move(this->_alloc, x._start() + common, x._end(), this->_end())
+							  - this->_start();
+			return *this;
+		}
+#endif
+
+		/* Iterator functions */
+	public:
+		iterator begin() { return iterator(this->_start()); }
+
+		const_iterator begin() const { return const_iterator(this->_start()); }
+
+		iterator end() { return iterator(this->_start() + this->_size); }
+
+		const_iterator end() const { return const_iterator(this->_start() + this->_size); }
+
+		reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+
+		reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+		const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+		/* Capacity functions */
+	public:
+		size_type size() const { return this->_size; }
+
+		size_type max_size() const { return N; }
+
+		size_type capacity() const { return N; }
+
+		bool empty() const { return this->_size == 0; }
+
+		bool full() const { return this->_size == N; }
+
+		void resize(size_type n, value_type val = value_type())
+		{
+			if (n > N)
+				throw std::length_error("ft::static_vector::resize");
+			if (n < this->_size)
+			{
+				ft::_destroy(this->_alloc, this->_start() + n, this->_end());
+				this->_size = n;
+				return;
+			}
+			this->_size = ft::_uninitialized_fill(this->_alloc, this->_end(), n - this->_size, val) - this->_start();
+		}
+
+		/* Only checks that 'n' elements fit, the storage is always there */
+		void reserve(size_type n)
+		{
+			if (n > N)
+				throw std::length_error("ft::static_vector::reserve");
+		}
+
+		/* Element access functions */
+	public:
+		reference operator[](size_type n) { return this->_start()[ n ]; }
+
+		const_reference operator[](size_type n) const { return this->_start()[ n ]; }
+
+		reference at(size_type n)
+		{
+			if (n >= this->_size)
+				throw std::out_of_range("ft::static_vector::at");
+			return this->_start()[ n ];
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= this->_size)
+				throw std::out_of_range("ft::static_vector::at");
+			return this->_start()[ n ];
+		}
+
+		reference front() { return *(this->begin()); }
+
+		const_reference front() const { return *(this->begin()); }
+
+		reference back() { return *(this->end() - 1); }
+
+		const_reference back() const { return *(this->end() - 1); }
+
+		pointer data() { return this->_start(); }
+
+		const_pointer data() const { return this->_start(); }
+
+		/* Modifiers functions */
+	public:
+		template < class InputIterator >
+		void assign(InputIterator first, InputIterator last,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, bool>::type = true)
+		{
+			this->_range_assign(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		void assign(size_type n, const value_type &val)
+		{
+			if (n > N)
+				throw std::length_error("ft::static_vector::assign");
+			const value_type val_copy(val);
+
+			this->clear();
+			this->_size = ft::_uninitialized_fill(this->_alloc, this->_start(), n, val_copy) - this->_start();
+		}
+
+		void push_back(const value_type &val)
+		{
+			this->_check_room(1, "ft::static_vector::push_back");
+			this->_alloc.construct(this->_end(), val);
+			++this->_size;
+		}
+
+#if FT_CXX11
+		void push_back(value_type &&val) { this->emplace_back(ft::move(val)); }
+
+		template < class... Args >
+		void emplace_back(Args &&...args)
+		{
+			this->_check_room(1, "ft::static_vector::emplace_back");
+			this->_alloc.construct(this->_end(), ft::forward<Args>(args)...);
+			++this->_size;
+		}
+
+		template < class... Args >
+		iterator emplace(iterator position, Args &&...args)
+		{
+			const size_type offset = position - this->begin();
+			this->_check_room(1, "ft::static_vector::emplace");
+			if (offset == this->_size)
+			{
+				this->_alloc.construct(this->_end(), ft::forward<Args>(args)...);
+				++this->_size;
+			}
+			else
+			{
+				value_type tmp(ft::forward<Args>(args)...);
+				_size_guard guard(*this);
+				ft::_emplace_in_place(this->_alloc, this->_start() + offset, guard.end, ft::move(tmp));
+			}
+			return iterator(this->_start() + offset);
+		}
+#endif
+
+		void pop_back()
+		{
+			--this->_size;
+			this->_alloc.destroy(this->_end());
+		}
+
+		iterator insert(iterator position, const value_type &val)
+		{
+			size_type dist = ft::distance(this->begin(), position);
+			insert(position, 1, val);
+			return iterator(this->_start() + dist);
+		}
+
+#if FT_CXX11
+		iterator insert(iterator position, value_type &&val) { return this->emplace(position, ft::move(val)); }
+#endif
+
+		void insert(iterator position, size_type n, const value_type &val)
+		{
+			if (n == 0)
+				return;
+			this->_check_room(n, "ft::static_vector::insert");
+			_size_guard guard(*this);
+			ft::_insert_fill_in_place(this->_alloc, position.base(), guard.end, n, val);
+		}
+
+		template < class InputIterator >
+		void insert(iterator position, InputIterator first, InputIterator last,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, bool>::type = true)
+		{
+			this->_range_insert(position - this->begin(), first, last,
+								typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		iterator erase(iterator position) { return erase(position, position + 1); }
+
+		iterator erase(iterator first, iterator last)
+		{
+			/* Keeps 'first' from being moved onto itself */
+			if (first == last)
+				return first;
+
+			_size_guard guard(*this);
+			ft::_erase_range(this->_alloc, first.base(), last.base(), guard.end);
+			return first;
+		}
+
+		/* Swaps the common prefix element-wise and moves the rest of the longer vector across */
+		void swap(static_vector &x)
+		{
+			static_vector &longer = this->_size < x._size ? x : *this;
+			static_vector &shorter = this->_size < x._size ? *this : x;
+			const size_type common = shorter._size;
+
+			for (size_type i = 0; i < common; ++i)
+			{
+				using std::swap;
+				swap(longer[ i ], shorter[ i ]);
+			}
+			shorter._size = ft::_uninitialized_move(this->_alloc, longer._start() + common, longer._end(),
+													shorter._end()) - shorter._start();
+			ft::_destroy(this->_alloc, longer._start() + common, longer._end());
+			longer._size = common;
+		}
+
+		void clear()
+		{
+			ft::_destroy(this->_alloc, this->_start(), this->_end());
+			this->_size = 0;
+		}
+	};
+
+	template < class T, std::size_t N >
+	ft::_in_place_allocator<T> static_vector<T, N>::_alloc;
+
+	/* A static_vector holds no pointer into itself, moving its bytes moves its elements */
+	template < class T, std::size_t N >
+	struct is_trivially_relocatable<ft::static_vector<T, N> > : bool_constant<is_trivially_relocatable<T>::value> { };
+
+	/* Relational Operators Overload */
+	template < class T, std::size_t N >
+	bool operator==(const static_vector<T, N> &lhs, const static_vector<T, N> &rhs)
+	{
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template < class T, std::size_t N >
+	bool operator!=(const static_vector<T, N> &lhs, const static_vector<T, N> &rhs) { return !(lhs == rhs); }
+
+	template < class T, std::size_t N >
+	bool operator<(const static_vector<T, N> &lhs, const static_vector<T, N> &rhs)
+	{
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template < class T, std::size_t N >
+	bool operator<=(const static_vector<T, N> &lhs, const static_vector<T, N> &rhs) { return !(rhs < lhs); }
+
+	template < class T, std::size_t N >
+	bool operator>(const static_vector<T, N> &lhs, const static_vector<T, N> &rhs) { return rhs < lhs; }
+
+	template < class T, std::size_t N >
+	bool operator>=(const static_vector<T, N> &lhs, const static_vector<T, N> &rhs) { return !(lhs < rhs); }
+
+	/* Swap */
+	template < class T, std::size_t N >
+	void swap(static_vector<T, N> &x, static_vector<T, N> &y) { x.swap(y); }
+
+} // namespace ft
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "../utility/compiler.hpp"
+
 namespace ft
 {
 	template < bool B, typename T = void >
@@ -55,6 +57,38 @@ namespace ft
 		typedef typename remove_volatile<typename remove_const<T>::type>::type type;
 	};
 
+	template < typename T >
+	struct remove_reference
+	{
+		typedef T type;
+	};
+
+	template < typename T >
+	struct remove_reference<T &>
+	{
+		typedef T type;
+	};
+
+#if FT_CXX11
+	template < typename T >
+	struct remove_reference<T &&>
+	{
+		typedef T type;
+	};
+#endif
+
+	template < bool B, typename T, typename F >
+	struct conditional
+	{
+		typedef T type;
+	};
+
+	template < typename T, typename F >
+	struct conditional<false, T, F>
+	{
+		typedef F type;
+	};
+
 	template < typename >
 	struct is_integral_base : public false_type { };
 
@@ -88,12 +122,178 @@ namespace ft
 	template < >
 	struct is_integral_base<unsigned long int> : public true_type { };
 
+#if FT_CXX11
+	template < >
+	struct is_integral_base<long long int> : public true_type { };
+
+	template < >
+	struct is_integral_base<unsigned long long int> : public true_type { };
+#endif
+
 	template < typename T >
 	struct is_integral : is_integral_base<typename remove_cv<T>::type> { };
 
+	/**
+	 * Unsigned integral type of the same size as the integral type 'T', 'unsigned char' for 'bool'
+	 */
+	template < typename T >
+	struct make_unsigned_base;
+
+	template < >
+	struct make_unsigned_base<bool> { typedef unsigned char type; };
+
+	template < >
+	struct make_unsigned_base<char> { typedef unsigned char type; };
+
+	template < >
+	struct make_unsigned_base<signed char> { typedef unsigned char type; };
+
+	template < >
+	struct make_unsigned_base<unsigned char> { typedef unsigned char type; };
+
+	template < >
+	struct make_unsigned_base<short int> { typedef unsigned short int type; };
+
+	template < >
+	struct make_unsigned_base<unsigned short int> { typedef unsigned short int type; };
+
+	template < >
+	struct make_unsigned_base<int> { typedef unsigned int type; };
+
+	template < >
+	struct make_unsigned_base<unsigned int> { typedef unsigned int type; };
+
+	template < >
+	struct make_unsigned_base<long int> { typedef unsigned long int type; };
+
+	template < >
+	struct make_unsigned_base<unsigned long int> { typedef unsigned long int type; };
+
+#if FT_CXX11
+	template < >
+	struct make_unsigned_base<long long int> { typedef unsigned long long int type; };
+
+	template < >
+	struct make_unsigned_base<unsigned long long int> { typedef unsigned long long int type; };
+#endif
+
+	template < typename T >
+	struct make_unsigned : make_unsigned_base<typename remove_cv<T>::type> { };
+
 	template < typename T, typename U >
 	struct is_same : public false_type { };
 
 	template < typename T >
 	struct is_same<T, T> : public true_type { };
+
+	template < bool B >
+	struct bool_constant : public false_type { };
+
+	template < >
+	struct bool_constant<true> : public true_type { };
+
+	template < typename >
+	struct is_floating_point_base : public false_type { };
+
+	template < >
+	struct is_floating_point_base<float> : public true_type { };
+
+	template < >
+	struct is_floating_point_base<double> : public true_type { };
+
+	template < >
+	struct is_floating_point_base<long double> : public true_type { };
+
+	template < typename T >
+	struct is_floating_point : is_floating_point_base<typename remove_cv<T>::type> { };
+
+	template < typename T >
+	struct is_arithmetic : bool_constant<is_integral<T>::value || is_floating_point<T>::value> { };
+
+	template < typename T >
+	struct is_pointer_base : public false_type { };
+
+	template < typename T >
+	struct is_pointer_base<T *> : public true_type { };
+
+	template < typename T >
+	struct is_pointer : is_pointer_base<typename remove_cv<T>::type> { };
+
+	/**
+	 * Whether copying a 'T' is equivalent to copying its bytes
+	 * @details Uses the compiler intrinsic where available, otherwise only recognizes arithmetic types and
+	 * pointers
+	 */
+	template < typename T >
+	struct is_trivially_copyable
+#if defined(__GNUC__) || defined(__clang__)
+			: bool_constant<__is_trivially_copyable(T)>
+#else
+			: bool_constant<is_arithmetic<T>::value || is_pointer<T>::value>
+#endif
+	{
+	};
+
+	/**
+	 * Whether destroying a 'T' is a no-op
+	 */
+	template < typename T >
+	struct is_trivially_destructible
+#if defined(__GNUC__) || defined(__clang__)
+			: bool_constant<__has_trivial_destructor(T)>
+#else
+			: bool_constant<is_arithmetic<T>::value || is_pointer<T>::value>
+#endif
+	{
+	};
+
+	/**
+	 * Whether default-initializing a 'T' leaves its storage untouched
+	 */
+	template < typename T >
+	struct is_trivially_default_constructible
+#if defined(__GNUC__) || defined(__clang__)
+			: bool_constant<__has_trivial_constructor(T)>
+#else
+			: bool_constant<is_arithmetic<T>::value || is_pointer<T>::value>
+#endif
+	{
+	};
+
+	/**
+	 * Whether a 'T' may be moved to another address by copying its bytes and forgetting the original,
+	 * without running its copy constructor and destructor
+	 * @details Holds for trivially copyable types. Specialize it as 'true_type' for own types that do not
+	 * store pointers into themselves, e.g. types owning a heap buffer.
+	 */
+	template < typename T >
+	struct is_trivially_relocatable : bool_constant<is_trivially_copyable<T>::value> { };
+
+	/**
+	 * Whether 'Alloc' has a 'reallocate(p, old_n, new_n)' that grows a buffer while keeping its bytes
+	 * @details Lets containers of trivially relocatable elements grow without copying them. The returned
+	 * buffer may be at another address, 'p' is then released.
+	 */
+	template < class Alloc >
+	struct allocator_can_reallocate : public false_type { };
+
+	/**
+	 * Whether 'Alloc' keeps a registry of the containers using it, through 'attach(owner, compact)'
+	 * @details Containers attach themselves with a function releasing their spare capacity, which the
+	 * allocator's registry calls on demand
+	 */
+	template < class Alloc >
+	struct allocator_is_compactable : public false_type { };
+
+#if FT_CXX11
+	/* Unevaluated value of type 'T', for use in 'noexcept' and 'decltype' expressions only */
+	template < typename T >
+	T &&declval() noexcept;
+
+	/**
+	 * Whether a 'T' can be constructed from an rvalue 'T' without throwing
+	 */
+	template < typename T >
+	struct is_nothrow_move_constructible : bool_constant<noexcept(T(ft::declval<T>()))> { };
+#endif
 } // namespace ft
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include "compiler.hpp"
+
+namespace ft
+{
+	/**
+	 * Raw storage suitably aligned for 'N' objects of type 'T', none of which it constructs
+	 * @details Before C++11 the bytes share a union with the most strictly aligned fundamental types.
+	 * A zero 'N' still reserves one slot, as arrays cannot be empty.
+	 */
+	template < class T, std::size_t N >
+	struct aligned_buffer
+	{
+		/* Public Members */
+	public:
+#if FT_CXX11
+		alignas(T) unsigned char bytes[ (N == 0 ? 1 : N) * sizeof(T) ];
+#else
+		union
+		{
+			unsigned char bytes[ (N == 0 ? 1 : N) * sizeof(T) ];
+			long double align_long_double;
+			double align_double;
+			long align_long;
+			void *align_pointer;
+			void (*align_function)();
+		} storage;
+#endif
+
+		/* Public Member Functions */
+	public:
+#if FT_CXX11
+		T *data() { return reinterpret_cast<T *>(this->bytes); }
+
+		const T *data() const { return reinterpret_cast<const T *>(this->bytes); }
+#else
+		T *data() { return reinterpret_cast<T *>(this->storage.bytes); }
+
+		const T *data() const { return reinterpret_cast<const T *>(this->storage.bytes); }
+#endif
+	};
+} // namespace ft
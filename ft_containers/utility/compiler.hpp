@@ -0,0 +1,17 @@
+#pragma once
+
+/* Keeps cold paths such as reallocation out of their inlined hot callers */
+#if defined(__GNUC__) || defined(__clang__)
+# define FT_NOINLINE __attribute__((noinline))
+#else
+# define FT_NOINLINE
+#endif
+
+/* C++11 mode adds move semantics and emplacement, define FT_CXX11 to 0 to keep the C++98 interface */
+#ifndef FT_CXX11
+# if __cplusplus >= 201103L
+#  define FT_CXX11 1
+# else
+#  define FT_CXX11 0
+# endif
+#endif
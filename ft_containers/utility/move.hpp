@@ -0,0 +1,40 @@
+#pragma once
+
+#include "compiler.hpp"
+#include "../type_traits/type_traits.hpp"
+
+namespace ft
+{
+#if FT_CXX11
+	template < class T >
+	typename ft::remove_reference<T>::type &&move(T &&t) noexcept
+	{
+		return static_cast<typename ft::remove_reference<T>::type &&>(t);
+	}
+
+	template < class T >
+	T &&forward(typename ft::remove_reference<T>::type &t) noexcept { return static_cast<T &&>(t); }
+
+	template < class T >
+	T &&forward(typename ft::remove_reference<T>::type &&t) noexcept { return static_cast<T &&>(t); }
+
+	/**
+	 * Casts 't' to an rvalue only if moving from it cannot throw
+	 * @details Lets reallocations move elements while keeping the strong exception guarantee, as a
+	 * throwing copy leaves the source intact where a throwing move might not
+	 */
+	template < class T >
+	typename ft::conditional<ft::is_nothrow_move_constructible<T>::value, T &&, const T &>::type
+	move_if_noexcept(T &t) noexcept
+	{
+		return ft::move(t);
+	}
+#else
+	/* Without rvalue references moving degrades to copying, so callers need no mode checks */
+	template < class T >
+	T &move(T &t) { return t; }
+
+	template < class T >
+	const T &move_if_noexcept(T &t) { return t; }
+#endif
+} // namespace ft
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <iostream>
+#include "../type_traits/type_traits.hpp"
+#include "move.hpp"
 
 namespace ft
 {
@@ -29,6 +31,15 @@ namespace ft
 		/* Initialization Constructor */
 		pair(const first_type &a, const second_type &b) : first(a), second(b) { }
 
+#if FT_CXX11
+		/* Declaring the move operations would otherwise delete the implicit copy constructor */
+		pair(const pair &pr) = default;
+
+		/* Move Constructor */
+		template < class U, class V >
+		pair(pair<U, V> &&pr) : first(ft::forward<U>(pr.first)), second(ft::forward<V>(pr.second)) { }
+#endif
+
 		/* Public Member Functions */
 	public:
 		pair &operator=(const pair &pr)
@@ -41,6 +52,16 @@ namespace ft
 
 			return *this;
 		}
+
+#if FT_CXX11
+		pair &operator=(pair &&pr)
+		{
+			this->first = ft::move(pr.first);
+			this->second = ft::move(pr.second);
+
+			return *this;
+		}
+#endif
 	};
 
 	/* Non-member function overloads */
@@ -77,4 +98,9 @@ namespace ft
 	template < class T1, class T2 >
 	ft::pair<T1, T2> make_pair(T1 x, T2 y) { return ft::pair<T1, T2>(x, y); }
 
+	/* A pair is relocatable if both members are, even where their copies are not trivial */
+	template < class T1, class T2 >
+	struct is_trivially_relocatable<ft::pair<T1, T2> >
+			: bool_constant<is_trivially_relocatable<T1>::value && is_trivially_relocatable<T2>::value> { };
+
 } // namespace ft
@@ -0,0 +1,17 @@
+#pragma once
+
+namespace ft
+{
+	/**
+	 * Hints the CPU to pull the cache line holding 'addr' into cache for reading
+	 * @details Compiles to nothing on compilers without '__builtin_prefetch'
+	 */
+	inline void prefetch(const void *addr)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(addr, 0, 3);
+#else
+		( void ) addr;
+#endif
+	}
+} // namespace ft
@@ -0,0 +1,306 @@
+#pragma once
+
+#include "compiler.hpp"
+
+#if FT_CXX11
+
+#include <cstddef>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ft
+{
+	/**
+	 * Pool of worker threads sharing work by stealing, for fork-join parallelism (C++11 only)
+	 * @details Each worker owns a queue: it pushes the tasks it submits at the back and takes the most recent
+	 * one first, while the tasks it forked first, usually the largest, are stolen from the front by idle
+	 * workers. Tasks submitted from outside the pool are dealt to the queues in turn. Idle workers sleep
+	 * until a task is submitted.
+	 */
+	class thread_pool
+	{
+		/* Member Types */
+	public:
+		typedef std::function<void()> task_type;
+		typedef std::size_t size_type;
+
+	private:
+		struct worker_queue
+		{
+			std::mutex mutex;
+			std::deque<task_type> tasks;
+		};
+
+		/* Pool and queue the calling thread works for, if it is a worker */
+		struct worker_info
+		{
+			thread_pool *pool;
+			size_type index;
+		};
+
+		/* Private Members */
+	private:
+		std::vector<std::unique_ptr<worker_queue> > _queues;
+		std::vector<std::thread> _threads;
+		/* Tasks queued and not taken yet */
+		std::atomic<size_type> _pending;
+		std::atomic<size_type> _next_queue;
+		std::mutex _sleep_mutex;
+		std::condition_variable _wake;
+		bool _stopping;
+
+		/* Private Functions */
+	private:
+		static worker_info &_current()
+		{
+			static thread_local worker_info info = { NULL, 0 };
+			return info;
+		}
+
+		/* Takes the newest task of queue 'index', or the oldest one of another queue */
+		bool _take(size_type index, task_type &task)
+		{
+			const size_type count = this->_queues.size();
+			for (size_type i = 0; i < count; ++i)
+			{
+				worker_queue &queue = *this->_queues[ (index + i) % count ];
+				std::lock_guard<std::mutex> lock(queue.mutex);
+				if (queue.tasks.empty())
+					continue;
+				if (i == 0)
+				{
+					task = std::move(queue.tasks.back());
+					queue.tasks.pop_back();
+				}
+				else
+				{
+					task = std::move(queue.tasks.front());
+					queue.tasks.pop_front();
+				}
+				--this->_pending;
+				return true;
+			}
+			return false;
+		}
+
+		void _work(size_type index)
+		{
+			worker_info &info = _current();
+			info.pool = this;
+			info.index = index;
+			task_type task;
+			for (;;)
+			{
+				if (this->_take(index, task))
+				{
+					task();
+					task = task_type();
+					continue;
+				}
+				std::unique_lock<std::mutex> lock(this->_sleep_mutex);
+				this->_wake.wait(lock, [this] { return this->_stopping || this->_pending > 0; });
+				if (this->_stopping && this->_pending == 0)
+					return;
+			}
+		}
+
+		thread_pool(const thread_pool &);
+
+		thread_pool &operator=(const thread_pool &);
+
+		/* Constructors */
+	public:
+		/**
+		 * Starts 'threads' workers
+		 * @details With no worker, tasks only run when a thread waiting on them helps
+		 */
+		explicit thread_pool(size_type threads = std::thread::hardware_concurrency())
+				: _queues(), _threads(), _pending(0), _next_queue(0), _sleep_mutex(), _wake(), _stopping(false)
+		{
+			const size_type queues = threads == 0 ? 1 : threads;
+			for (size_type i = 0; i < queues; ++i)
+				this->_queues.push_back(std::unique_ptr<worker_queue>(new worker_queue()));
+			try
+			{
+				for (size_type i = 0; i < threads; ++i)
+					this->_threads.push_back(std::thread(&thread_pool::_work, this, i));
+			}
+			catch (...)
+			{
+				this->_stop();
+				throw;
+			}
+		}
+
+		/* Destructors */
+	public:
+		/* Runs the tasks still queued, then joins the workers */
+		~thread_pool() { this->_stop(); }
+
+	private:
+		void _stop()
+		{
+			{
+				std::lock_guard<std::mutex> lock(this->_sleep_mutex);
+				this->_stopping = true;
+			}
+			this->_wake.notify_all();
+			for (size_type i = 0; i < this->_threads.size(); ++i)
+				this->_threads[ i ].join();
+			this->_threads.clear();
+			task_type task;
+			while (this->_take(0, task))
+				task();
+		}
+
+		/* Member functions */
+	public:
+		/**
+		 * Pool shared by the parallel algorithms, started on first use
+		 * @details Has a worker less than the hardware threads, as the thread calling an algorithm works on it
+		 * too while waiting
+		 */
+		static thread_pool &instance()
+		{
+			static const size_type hardware = std::thread::hardware_concurrency();
+			static thread_pool pool(hardware > 1 ? hardware - 1 : 0);
+			return pool;
+		}
+
+		size_type size() const { return this->_threads.size(); }
+
+		/* Threads working on the tasks of a fork-join algorithm, the workers and the caller */
+		size_type concurrency() const { return this->_threads.size() + 1; }
+
+		/* Queues 'task', on the queue of the calling worker if it belongs to this pool */
+		void submit(task_type task)
+		{
+			const worker_info &info = _current();
+			const size_type index =
+					info.pool == this ? info.index : this->_next_queue++ % this->_queues.size();
+			/* Counted first, so that the count never drops below zero when the task is taken right away */
+			++this->_pending;
+			try
+			{
+				worker_queue &queue = *this->_queues[ index ];
+				std::lock_guard<std::mutex> lock(queue.mutex);
+				queue.tasks.push_back(std::move(task));
+			}
+			catch (...)
+			{
+				--this->_pending;
+				throw;
+			}
+			/* Taking the lock orders the increment before a worker checking it and going to sleep */
+			{
+				std::lock_guard<std::mutex> lock(this->_sleep_mutex);
+			}
+			this->_wake.notify_one();
+		}
+
+		/**
+		 * Runs a queued task on the calling thread, preferring the own queue of a worker
+		 * @return Whether there was a task to run
+		 */
+		bool run_pending_task()
+		{
+			const worker_info &info = _current();
+			task_type task;
+			if (!this->_take(info.pool == this ? info.index : 0, task))
+				return false;
+			task();
+			return true;
+		}
+	};
+
+	/**
+	 * Set of tasks run on a 'thread_pool' and waited for together (C++11 only)
+	 * @details While waiting, the calling thread runs queued tasks, which makes nested groups safe: a task
+	 * waiting on the tasks it forked keeps its worker busy instead of blocking it. The first exception
+	 * thrown by a task is rethrown by 'wait', the other tasks still run.
+	 */
+	class task_group
+	{
+		/* Private Members */
+	private:
+		thread_pool &_pool;
+		std::atomic<std::size_t> _running;
+		std::mutex _error_mutex;
+		std::exception_ptr _error;
+
+		task_group(const task_group &);
+
+		task_group &operator=(const task_group &);
+
+		/* Constructors */
+	public:
+		explicit task_group(thread_pool &pool = thread_pool::instance())
+				: _pool(pool), _running(0), _error_mutex(), _error()
+		{
+		}
+
+		/* Destructors */
+	public:
+		/* Waits for the tasks still running, as they may refer to the caller's frame */
+		~task_group()
+		{
+			while (this->_running > 0)
+				if (!this->_pool.run_pending_task())
+					std::this_thread::yield();
+		}
+
+		/* Member functions */
+	public:
+		template < class Function >
+		void run(Function f)
+		{
+			++this->_running;
+			try
+			{
+				this->_pool.submit([this, f]() mutable {
+					try
+					{
+						f();
+					}
+					catch (...)
+					{
+						std::lock_guard<std::mutex> lock(this->_error_mutex);
+						if (!this->_error)
+							this->_error = std::current_exception();
+					}
+					--this->_running;
+				});
+			}
+			catch (...)
+			{
+				--this->_running;
+				throw;
+			}
+		}
+
+		/* Runs queued tasks until those of the group are done, then rethrows the first exception they threw */
+		void wait()
+		{
+			while (this->_running > 0)
+				if (!this->_pool.run_pending_task())
+					std::this_thread::yield();
+			std::exception_ptr error;
+			{
+				std::lock_guard<std::mutex> lock(this->_error_mutex);
+				error = this->_error;
+				this->_error = std::exception_ptr();
+			}
+			if (error)
+				std::rethrow_exception(error);
+		}
+	};
+} // namespace ft
+
+#endif
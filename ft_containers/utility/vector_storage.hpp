@@ -0,0 +1,407 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include "compiler.hpp"
+#include "move.hpp"
+#include "../algorithm/copy.hpp"
+#include "../algorithm/move.hpp"
+#include "../algorithm/max.hpp"
+#include "../iterator/iterator_utils.hpp"
+#include "../type_traits/type_traits.hpp"
+
+namespace ft
+{
+	/* Vector Storage Operations */
+	/*
+	 * Element operations on the contiguous storage of 'ft::vector', 'ft::small_vector' and 'ft::static_vector'.
+	 * Elements are constructed and destroyed through 'alloc'. Operations changing the number of elements take the
+	 * end of the elements as 'end' and keep it past the last live element, also when they throw half way, so that
+	 * the container always knows which elements to destroy. Owning the storage stays up to the container.
+	 */
+
+	/* Allocator of containers with storage of their own, which constructs and destroys elements but never allocates */
+	template < class T >
+	struct _in_place_allocator
+	{
+		typedef T value_type;
+		typedef T *pointer;
+		typedef std::size_t size_type;
+
+#if FT_CXX11
+		template < class... Args >
+		void construct(pointer p, Args &&...args)
+		{
+			::new(static_cast<void *>(p)) value_type(ft::forward<Args>(args)...);
+		}
+#else
+		template < class U >
+		void construct(pointer p, const U &val) { ::new(static_cast<void *>(p)) value_type(val); }
+#endif
+
+		void destroy(pointer p) { p->~value_type(); }
+	};
+
+	template < class Alloc >
+	void _destroy(Alloc &, typename Alloc::pointer, typename Alloc::pointer, ft::true_type) { }
+
+	template < class Alloc >
+	void _destroy(Alloc &alloc, typename Alloc::pointer first, typename Alloc::pointer last, ft::false_type)
+	{
+		for (; first != last; ++first)
+			alloc.destroy(first);
+	}
+
+	template < class Alloc >
+	void _destroy(Alloc &alloc, typename Alloc::pointer first, typename Alloc::pointer last)
+	{
+		ft::_destroy(alloc, first, last, ft::is_trivially_destructible<typename Alloc::value_type>());
+	}
+
+	/**
+	 * Copy-constructs [first, last) into raw storage at 'dest'
+	 * @details Destroys what was already constructed if a copy throws
+	 * @return Pointer past the last constructed element
+	 */
+	template < class Alloc, class InputIterator >
+	typename Alloc::pointer _uninitialized_copy(Alloc &alloc, InputIterator first, InputIterator last,
+												typename Alloc::pointer dest)
+	{
+		typename Alloc::pointer cur = dest;
+		try
+		{
+			for (; first != last; ++first, ++cur)
+				alloc.construct(cur, *first);
+		}
+		catch (...)
+		{
+			ft::_destroy(alloc, dest, cur);
+			throw;
+		}
+		return cur;
+	}
+
+	/**
+	 * Copy-constructs 'n' copies of 'val' into raw storage at 'dest'
+	 * @return Pointer past the last constructed element
+	 */
+	template < class Alloc >
+	typename Alloc::pointer _uninitialized_fill(Alloc &alloc, typename Alloc::pointer dest, typename Alloc::size_type n,
+												const typename Alloc::value_type &val)
+	{
+		typename Alloc::pointer cur = dest;
+		try
+		{
+			for (; n > 0; --n, ++cur)
+				alloc.construct(cur, val);
+		}
+		catch (...)
+		{
+			ft::_destroy(alloc, dest, cur);
+			throw;
+		}
+		return cur;
+	}
+
+	/**
+	 * Move-constructs [first, last) into raw storage at 'dest', copying instead outside C++11 mode
+	 * @return Pointer past the last constructed element
+	 */
+	template < class Alloc >
+	typename Alloc::pointer _uninitialized_move(Alloc &alloc, typename Alloc::pointer first,
+												typename Alloc::pointer last, typename Alloc::pointer dest)
+	{
+		typename Alloc::pointer cur = dest;
+		try
+		{
+			for (; first != last; ++first, ++cur)
+				alloc.construct(cur, ft::move(*first));
+		}
+		catch (...)
+		{
+			ft::_destroy(alloc, dest, cur);
+			throw;
+		}
+		return cur;
+	}
+
+	/**
+	 * Constructs [first, last) into raw storage at 'dest' when reallocating
+	 * @details Elements are only moved if their move constructor cannot throw, so that a throw leaves
+	 * all originals intact
+	 * @return Pointer past the last constructed element
+	 */
+	template < class Alloc >
+	typename Alloc::pointer _uninitialized_move_if_noexcept(Alloc &alloc, typename Alloc::pointer first,
+															typename Alloc::pointer last, typename Alloc::pointer dest)
+	{
+		typename Alloc::pointer cur = dest;
+		try
+		{
+			for (; first != last; ++first, ++cur)
+				alloc.construct(cur, ft::move_if_noexcept(*first));
+		}
+		catch (...)
+		{
+			ft::_destroy(alloc, dest, cur);
+			throw;
+		}
+		return cur;
+	}
+
+	/* Relocation Functions */
+	/* Relocatable elements are moved bytewise, the old storage then only holds raw memory */
+	template < class Alloc >
+	void _relocate_around_gap(Alloc &, typename Alloc::pointer start, typename Alloc::pointer end,
+							  typename Alloc::pointer new_start, typename Alloc::size_type offset,
+							  typename Alloc::size_type n, ft::true_type)
+	{
+		const typename Alloc::size_type size = end - start;
+		if (offset != 0)
+			std::memcpy(static_cast<void *>(new_start), static_cast<const void *>(start),
+						offset * sizeof(typename Alloc::value_type));
+		if (size != offset)
+			std::memcpy(static_cast<void *>(new_start + offset + n), static_cast<const void *>(start + offset),
+						(size - offset) * sizeof(typename Alloc::value_type));
+	}
+
+	/* Other elements are all moved or copied before any is destroyed, so a throwing copy loses nothing */
+	template < class Alloc >
+	void _relocate_around_gap(Alloc &alloc, typename Alloc::pointer start, typename Alloc::pointer end,
+							  typename Alloc::pointer new_start, typename Alloc::size_type offset,
+							  typename Alloc::size_type n, ft::false_type)
+	{
+		typename Alloc::pointer prefix_end = ft::_uninitialized_move_if_noexcept(alloc, start, start + offset,
+																				 new_start);
+		try
+		{
+			ft::_uninitialized_move_if_noexcept(alloc, start + offset, end, new_start + offset + n);
+		}
+		catch (...)
+		{
+			ft::_destroy(alloc, new_start, prefix_end);
+			throw;
+		}
+		ft::_destroy(alloc, start, end);
+	}
+
+	/**
+	 * Moves the elements of [start, end) to raw storage at 'new_start', leaving a gap of 'n' elements at
+	 * 'offset'
+	 * @details The elements are left in [start, end) if moving them throws
+	 */
+	template < class Alloc >
+	void _relocate_around_gap(Alloc &alloc, typename Alloc::pointer start, typename Alloc::pointer end,
+							  typename Alloc::pointer new_start, typename Alloc::size_type offset,
+							  typename Alloc::size_type n)
+	{
+		ft::_relocate_around_gap(alloc, start, end, new_start, offset, n,
+								 ft::is_trivially_relocatable<typename Alloc::value_type>());
+	}
+
+	/* Moves the relocatable elements of [pos, end) up by 'n', leaving raw storage behind */
+	template < class Pointer, class Size >
+	void _open_gap(Pointer pos, Pointer &end, Size n)
+	{
+		std::memmove(static_cast<void *>(pos + n), static_cast<const void *>(pos), (end - pos) * sizeof(*pos));
+		end += n;
+	}
+
+	/* Reverts '_open_gap' once the gap holds no constructed element anymore */
+	template < class Pointer, class Size >
+	void _close_gap(Pointer pos, Pointer &end, Size n)
+	{
+		end -= n;
+		std::memmove(static_cast<void *>(pos), static_cast<const void *>(pos + n), (end - pos) * sizeof(*pos));
+	}
+
+	/* Insertion Functions */
+	/* Relocatable tails are moved up bytewise and the range is constructed in the hole */
+	template < class Alloc, class ForwardIterator >
+	void _insert_range_in_place(Alloc &alloc, typename Alloc::pointer pos, typename Alloc::pointer &end,
+								ForwardIterator first, ForwardIterator last, typename Alloc::size_type n,
+								ft::true_type)
+	{
+		ft::_open_gap(pos, end, n);
+		try
+		{
+			ft::_uninitialized_copy(alloc, first, last, pos);
+		}
+		catch (...)
+		{
+			ft::_close_gap(pos, end, n);
+			throw;
+		}
+	}
+
+	/* Other tails are moved up element-wise, constructing the part that lands in raw storage */
+	template < class Alloc, class ForwardIterator >
+	void _insert_range_in_place(Alloc &alloc, typename Alloc::pointer pos, typename Alloc::pointer &end,
+								ForwardIterator first, ForwardIterator last, typename Alloc::size_type n,
+								ft::false_type)
+	{
+		typename Alloc::pointer old_end = end;
+		const typename Alloc::size_type elems_after = old_end - pos;
+		if (elems_after > n)
+		{
+			end = ft::_uninitialized_move(alloc, old_end - n, old_end, old_end);
+			ft::move_backward(pos, old_end - n, old_end);
+			ft::copy(first, last, pos);
+		}
+		else
+		{
+			ForwardIterator mid = first;
+			ft::advance(mid, elems_after);
+			end = ft::_uninitialized_copy(alloc, mid, last, old_end);
+			end = ft::_uninitialized_move(alloc, pos, old_end, end);
+			ft::copy(first, mid, pos);
+		}
+	}
+
+	/**
+	 * Inserts the 'n' elements of [first, last) before 'pos', the spare storage past 'end' fitting them
+	 */
+	template < class Alloc, class ForwardIterator >
+	void _insert_range_in_place(Alloc &alloc, typename Alloc::pointer pos, typename Alloc::pointer &end,
+								ForwardIterator first, ForwardIterator last, typename Alloc::size_type n)
+	{
+		ft::_insert_range_in_place(alloc, pos, end, first, last, n,
+								   ft::is_trivially_relocatable<typename Alloc::value_type>());
+	}
+
+	template < class Alloc >
+	void _insert_fill_in_place(Alloc &alloc, typename Alloc::pointer pos, typename Alloc::pointer &end,
+							   typename Alloc::size_type n, const typename Alloc::value_type &val, ft::true_type)
+	{
+		const typename Alloc::value_type val_copy(val);
+		ft::_open_gap(pos, end, n);
+		try
+		{
+			ft::_uninitialized_fill(alloc, pos, n, val_copy);
+		}
+		catch (...)
+		{
+			ft::_close_gap(pos, end, n);
+			throw;
+		}
+	}
+
+	template < class Alloc >
+	void _insert_fill_in_place(Alloc &alloc, typename Alloc::pointer pos, typename Alloc::pointer &end,
+							   typename Alloc::size_type n, const typename Alloc::value_type &val, ft::false_type)
+	{
+		const typename Alloc::value_type val_copy(val);
+		typename Alloc::pointer old_end = end;
+		const typename Alloc::size_type elems_after = old_end - pos;
+		if (elems_after > n)
+		{
+			end = ft::_uninitialized_move(alloc, old_end - n, old_end, old_end);
+			ft::move_backward(pos, old_end - n, old_end);
+			for (typename Alloc::pointer p = pos; p != pos + n; ++p)
+				*p = val_copy;
+		}
+		else
+		{
+			end = ft::_uninitialized_fill(alloc, old_end, n - elems_after, val_copy);
+			end = ft::_uninitialized_move(alloc, pos, old_end, end);
+			for (typename Alloc::pointer p = pos; p != old_end; ++p)
+				*p = val_copy;
+		}
+	}
+
+	/**
+	 * Inserts 'n' copies of 'val' before 'pos', the spare storage past 'end' fitting them
+	 * @details 'val' is copied first, as it may be one of the elements being shifted
+	 */
+	template < class Alloc >
+	void _insert_fill_in_place(Alloc &alloc, typename Alloc::pointer pos, typename Alloc::pointer &end,
+							   typename Alloc::size_type n, const typename Alloc::value_type &val)
+	{
+		ft::_insert_fill_in_place(alloc, pos, end, n, val, ft::is_trivially_relocatable<typename Alloc::value_type>());
+	}
+
+#if FT_CXX11
+	template < class Alloc >
+	void _emplace_in_place(Alloc &alloc, typename Alloc::pointer pos, typename Alloc::pointer &end,
+						   typename Alloc::value_type &&tmp, ft::true_type)
+	{
+		ft::_open_gap(pos, end, 1);
+		try
+		{
+			alloc.construct(pos, ft::move(tmp));
+		}
+		catch (...)
+		{
+			ft::_close_gap(pos, end, 1);
+			throw;
+		}
+	}
+
+	template < class Alloc >
+	void _emplace_in_place(Alloc &alloc, typename Alloc::pointer pos, typename Alloc::pointer &end,
+						   typename Alloc::value_type &&tmp, ft::false_type)
+	{
+		typename Alloc::pointer old_end = end;
+		alloc.construct(old_end, ft::move(*(old_end - 1)));
+		++end;
+		ft::move_backward(pos, old_end - 1, old_end);
+		*pos = ft::move(tmp);
+	}
+
+	/* Moves 'tmp' in before 'pos', which is not 'end', the spare storage past 'end' fitting it */
+	template < class Alloc >
+	void _emplace_in_place(Alloc &alloc, typename Alloc::pointer pos, typename Alloc::pointer &end,
+						   typename Alloc::value_type &&tmp)
+	{
+		ft::_emplace_in_place(alloc, pos, end, ft::move(tmp),
+							  ft::is_trivially_relocatable<typename Alloc::value_type>());
+	}
+#endif
+
+	/* Erasure Functions */
+	/* Relocatable elements are destroyed in place and the tail is moved down bytewise */
+	template < class Alloc >
+	void _erase_range(Alloc &alloc, typename Alloc::pointer first, typename Alloc::pointer last,
+					  typename Alloc::pointer &end, ft::true_type)
+	{
+		ft::_destroy(alloc, first, last);
+		std::memmove(static_cast<void *>(first), static_cast<const void *>(last),
+					 (end - last) * sizeof(typename Alloc::value_type));
+		end -= last - first;
+	}
+
+	/* Other elements are move-assigned over the erased ones, and the tail is destroyed */
+	template < class Alloc >
+	void _erase_range(Alloc &alloc, typename Alloc::pointer first, typename Alloc::pointer last,
+					  typename Alloc::pointer &end, ft::false_type)
+	{
+		typename Alloc::pointer new_end = ft::move(last, end, first);
+		ft::_destroy(alloc, new_end, end);
+		end = new_end;
+	}
+
+	/* Removes the non-empty range [first, last) from the elements ending at 'end' */
+	template < class Alloc >
+	void _erase_range(Alloc &alloc, typename Alloc::pointer first, typename Alloc::pointer last,
+					  typename Alloc::pointer &end)
+	{
+		ft::_erase_range(alloc, first, last, end, ft::is_trivially_relocatable<typename Alloc::value_type>());
+	}
+
+	/* Growth Functions */
+	/**
+	 * Computes the capacity to grow to from 'capacity' so that at least 'n' elements fit, at most 'max'
+	 * @details Grows geometrically so that repeated appends reallocate O(log n) times
+	 */
+	template < class Size >
+	Size _recommend_capacity(Size capacity, Size n, Size max, const char *what)
+	{
+		if (n > max)
+			throw std::length_error(what);
+		if (capacity >= max / 2)
+			return max;
+		return ft::max<Size>(capacity * 2, n);
+	}
+} // namespace ft
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <new>
 #include "iterator/vector_iterator.hpp"
 #include "iterator/reverse_iterator.hpp"
 #include "type_traits/type_traits.hpp"
@@ -9,8 +10,13 @@
 #include "algorithm/lexicographical_compare.hpp"
 #include "algorithm/copy.hpp"
 #include "algorithm/min.hpp"
+#include "algorithm/max.hpp"
+#include "utility/compiler.hpp"
+#include "utility/move.hpp"
+#include "utility/vector_storage.hpp"
 #include <stdexcept>
 #include <limits>
+#include <cstring>
 
 namespace ft
 {
@@ -82,14 +88,371 @@ namespace ft
 			}
 		}
 
-		void _destroy(pointer start, pointer end)
+		/**
+		 * Default-initializes 'n' elements in raw storage at 'dest'
+		 * @details Trivial types are left indeterminate rather than zeroed, others get their default constructor
+		 * @return Pointer past the last constructed element
+		 */
+		pointer _default_init(pointer dest, size_type n)
 		{
-			for (pointer i = start; i != end; ++i)
+			return this->_default_init(dest, n, ft::is_trivially_default_constructible<value_type>());
+		}
+
+		pointer _default_init(pointer dest, size_type n, ft::true_type) { return dest + n; }
+
+		pointer _default_init(pointer dest, size_type n, ft::false_type)
+		{
+			pointer cur = dest;
+			try
+			{
+				for (; n > 0; --n, ++cur)
+					::new(static_cast<void *>(cur)) value_type;
+			}
+			catch (...)
+			{
+				ft::_destroy(this->_alloc, dest, cur);
+				throw;
+			}
+			return cur;
+		}
+
+		/* Relocation Functions */
+		/**
+		 * Moves all elements into 'new_start', leaving a gap of 'n' elements at 'offset', and adopts
+		 * 'new_start' as buffer
+		 * @details The gap must already be constructed by the caller, which lets inserted values refer to
+		 * old elements. If moving throws, the gap and 'new_start' are released and the vector is unchanged.
+		 */
+		void _adopt_buffer(pointer new_start, size_type new_capacity, size_type offset, size_type n)
+		{
+			const size_type old_size = this->size();
+			try
+			{
+				ft::_relocate_around_gap(this->_alloc, this->_content.start, this->_content.end, new_start, offset, n);
+			}
+			catch (...)
+			{
+				ft::_destroy(this->_alloc, new_start + offset, new_start + offset + n);
+				this->_alloc.deallocate(new_start, new_capacity);
+				throw;
+			}
+			if (this->_content.start != NULL)
+				this->_alloc.deallocate(this->_content.start, this->_capacity);
+			this->_content.start = new_start;
+			this->_content.end = new_start + old_size + n;
+			this->_capacity = new_capacity;
+		}
+
+		/* Whether the buffer can grow through 'allocator_type::reallocate' instead of being copied */
+		typedef ft::bool_constant<ft::allocator_can_reallocate<allocator_type>::value &&
+								  ft::is_trivially_relocatable<value_type>::value> _can_reallocate;
+
+		/**
+		 * Moves the elements to a buffer of 'new_capacity' elements
+		 * @details Allocators able to reallocate grow the buffer itself, e.g. with 'mremap', so the elements
+		 * are neither copied nor briefly held twice
+		 */
+		void _reallocate(size_type new_capacity)
+		{
+			this->_reallocate(new_capacity, _can_reallocate());
+		}
+
+		void _reallocate(size_type new_capacity, ft::false_type)
+		{
+			this->_adopt_buffer(this->_alloc.allocate(new_capacity), new_capacity, this->size(), 0);
+		}
+
+		void _reallocate(size_type new_capacity, ft::true_type)
+		{
+			if (this->_content.start == NULL)
+			{
+				this->_allocate_content(new_capacity);
+				return;
+			}
+			const size_type size = this->size();
+			this->_content.start = this->_alloc.reallocate(this->_content.start, this->_capacity, new_capacity);
+			this->_content.end = this->_content.start + size;
+			this->_capacity = new_capacity;
+		}
+
+		void _release_content(const content &old_content, size_type old_capacity)
+		{
+			ft::_destroy(this->_alloc, old_content.start, old_content.end);
+			if (old_content.start != NULL)
+				this->_alloc.deallocate(old_content.start, old_capacity);
+		}
+
+		/**
+		 * Inserts the 'n' elements of [first, last) before 'offset'
+		 * @details Shifts the tail in place when the spare capacity suffices, otherwise moves everything
+		 * to a geometrically grown buffer
+		 */
+		template < class ForwardIterator >
+		void _insert_range(size_type offset, ForwardIterator first, ForwardIterator last, size_type n)
+		{
+			if (n == 0)
+				return;
+			if (this->_capacity - this->size() >= n)
+			{
+				ft::_insert_range_in_place(this->_alloc, this->_content.start + offset, this->_content.end,
+										   first, last, n);
+				return;
+			}
+			const size_type new_capacity = this->_recommend_capacity(this->size() + n);
+			pointer new_start = this->_alloc.allocate(new_capacity);
+			try
+			{
+				ft::_uninitialized_copy(this->_alloc, first, last, new_start + offset);
+			}
+			catch (...)
+			{
+				this->_alloc.deallocate(new_start, new_capacity);
+				throw;
+			}
+			this->_adopt_buffer(new_start, new_capacity, offset, n);
+		}
+
+		/**
+		 * Removes the elements satisfying 'pred' in a single pass
+		 * @return Number of elements removed
+		 */
+		template < class Predicate >
+		size_type _erase_if(Predicate pred)
+		{
+			const size_type old_size = this->size();
+			this->_erase_if(pred, ft::is_trivially_relocatable<value_type>());
+			return old_size - this->size();
+		}
+
+		/**
+		 * Destroys removed elements as they are found and moves each run of survivors down bytewise
+		 * @details 'live' starts the survivors not yet moved, which are all brought down if 'pred' throws
+		 */
+		template < class Predicate >
+		void _erase_if(Predicate &pred, ft::true_type)
+		{
+			pointer dest = this->_content.start;
+			pointer live = this->_content.start;
+			try
+			{
+				for (pointer cur = this->_content.start; cur != this->_content.end; ++cur)
+				{
+					if (!pred(*cur))
+						continue;
+					if (dest != live)
+						std::memmove(static_cast<void *>(dest), static_cast<const void *>(live),
+									 (cur - live) * sizeof(value_type));
+					dest += cur - live;
+					this->_alloc.destroy(cur);
+					live = cur + 1;
+				}
+			}
+			catch (...)
+			{
+				this->_close_holes(dest, live);
+				throw;
+			}
+			this->_close_holes(dest, live);
+		}
+
+		/* Moves the survivors from 'live' to the end down to 'dest' */
+		void _close_holes(pointer dest, pointer live)
+		{
+			if (dest == live)
+				return;
+			std::memmove(static_cast<void *>(dest), static_cast<const void *>(live),
+						 (this->_content.end - live) * sizeof(value_type));
+			this->_content.end = dest + (this->_content.end - live);
+		}
+
+		/* Other elements are move-assigned over the removed ones, and the tail is destroyed once */
+		template < class Predicate >
+		void _erase_if(Predicate &pred, ft::false_type)
+		{
+			pointer dest = this->_content.start;
+			for (pointer cur = this->_content.start; cur != this->_content.end; ++cur)
+			{
+				if (pred(*cur))
+					continue;
+				if (dest != cur)
+					*dest = ft::move(*cur);
+				++dest;
+			}
+			ft::_destroy(this->_alloc, dest, this->_content.end);
+			this->_content.end = dest;
+		}
+
+		/* Predicate of 'ft::erase', holds a copy as 'val' may be one of the elements being removed */
+		struct _equals
+		{
+			const value_type val;
+
+			explicit _equals(const value_type &x) : val(x) { }
+
+			bool operator()(const value_type &x) const { return x == this->val; }
+		};
+
+		/* Range Dispatch Functions */
+		/* Single pass ranges are appended one by one, as their length is only known at their end */
+		template < class InputIterator >
+		void _range_init(InputIterator first, InputIterator last, ft::input_iterator_tag)
+		{
+			for (; first != last; ++first)
+				this->push_back(*first);
+		}
+
+		/* Multi pass ranges are measured once and copied straight into an exactly sized buffer */
+		template < class ForwardIterator >
+		void _range_init(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+		{
+			const size_type n = ft::distance(first, last);
+			if (n == 0)
+				return;
+			if (n > this->max_size())
+				throw std::length_error("ft::vector");
+			this->_allocate_content(n);
+			try
+			{
+				this->_content.end = ft::_uninitialized_copy(this->_alloc, first, last, this->_content.start);
+			}
+			catch (...)
+			{
+				this->_alloc.deallocate(this->_content.start, this->_capacity);
+				throw;
+			}
+		}
+
+		template < class InputIterator >
+		void _range_assign(InputIterator first, InputIterator last, ft::input_iterator_tag)
+		{
+			this->clear();
+			for (; first != last; ++first)
+				this->push_back(*first);
+		}
+
+		template < class ForwardIterator >
+		void _range_assign(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+		{
+			const size_type n = ft::distance(first, last);
+			if (n > this->_capacity)
 			{
-				this->_alloc.destroy(i);
+				if (n > this->max_size())
+					throw std::length_error("ft::vector::assign");
+				pointer new_start = this->_alloc.allocate(n);
+				pointer new_end;
+				try
+				{
+					new_end = ft::_uninitialized_copy(this->_alloc, first, last, new_start);
+				}
+				catch (...)
+				{
+					this->_alloc.deallocate(new_start, n);
+					throw;
+				}
+				this->_release_content(this->_content, this->_capacity);
+				this->_content.start = new_start;
+				this->_content.end = new_end;
+				this->_capacity = n;
+			}
+			else if (n <= this->size())
+			{
+				pointer new_end = ft::copy(first, last, this->_content.start);
+				ft::_destroy(this->_alloc, new_end, this->_content.end);
+				this->_content.end = new_end;
+			}
+			else
+			{
+				ForwardIterator mid = first;
+				ft::advance(mid, this->size());
+				ft::copy(first, mid, this->_content.start);
+				this->_content.end = ft::_uninitialized_copy(this->_alloc, mid, last, this->_content.end);
 			}
 		}
 
+		template < class InputIterator >
+		void _range_insert(size_type offset, InputIterator first, InputIterator last, ft::input_iterator_tag)
+		{
+			vector vc(first, last);
+			this->_insert_range(offset, vc.begin(), vc.end(), vc.size());
+		}
+
+		template < class ForwardIterator >
+		void _range_insert(size_type offset, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+		{
+			this->_insert_range(offset, first, last, ft::distance(first, last));
+		}
+
+		/* Computes the capacity to grow to so that at least 'n' elements fit */
+		size_type _recommend_capacity(size_type n) const
+		{
+			return ft::_recommend_capacity(this->_capacity, n, this->max_size(), "ft::vector");
+		}
+
+		/**
+		 * Slow path of 'push_back': moves the content to a larger buffer and appends 'val'
+		 * @details 'val' is copied into the new buffer before the old one is released, as it may refer
+		 * to one of the old elements
+		 */
+		FT_NOINLINE void _realloc_push_back(const value_type &val)
+		{
+			const size_type n = this->size();
+			const size_type new_capacity = this->_recommend_capacity(n + 1);
+
+			if (_can_reallocate::value)
+			{
+				// The old buffer may move, taking 'val' with it
+				const value_type tmp(val);
+				this->_reallocate(new_capacity);
+				this->_alloc.construct(this->_content.end, tmp);
+				++this->_content.end;
+				return;
+			}
+			pointer new_start = this->_alloc.allocate(new_capacity);
+			try
+			{
+				this->_alloc.construct(new_start + n, val);
+			}
+			catch (...)
+			{
+				this->_alloc.deallocate(new_start, new_capacity);
+				throw;
+			}
+			this->_adopt_buffer(new_start, new_capacity, n, 1);
+		}
+
+#if FT_CXX11
+		/**
+		 * Moves the content to a larger buffer and constructs an element from 'args' at 'offset'
+		 * @details The element is constructed before the old buffer is released, as 'args' may refer to
+		 * old elements
+		 */
+		template < class... Args >
+		FT_NOINLINE void _realloc_emplace(size_type offset, Args &&...args)
+		{
+			const size_type new_capacity = this->_recommend_capacity(this->size() + 1);
+
+			if (_can_reallocate::value && offset == this->size())
+			{
+				value_type tmp(ft::forward<Args>(args)...);
+				this->_reallocate(new_capacity);
+				this->_alloc.construct(this->_content.end, ft::move(tmp));
+				++this->_content.end;
+				return;
+			}
+			pointer new_start = this->_alloc.allocate(new_capacity);
+			try
+			{
+				this->_alloc.construct(new_start + offset, ft::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				this->_alloc.deallocate(new_start, new_capacity);
+				throw;
+			}
+			this->_adopt_buffer(new_start, new_capacity, offset, 1);
+		}
+#endif
+
 		void _copy_assign_alloc(const vector &x)
 		{
 			if (this->_alloc != x._alloc)
@@ -97,19 +460,46 @@ namespace ft
 				this->clear();
 				this->_alloc.deallocate(this->_content.start, this->_capacity);
 				this->_content.start = this->_content.end = NULL;
+				this->_capacity = 0;
 			}
 			this->_alloc = x._alloc;
 		}
 
+		/* Registers the vector with its allocator, if it is compactable, so that it can be shrunk from outside */
+		void _attach_allocator()
+		{
+			this->_attach_allocator(ft::allocator_is_compactable<allocator_type>());
+		}
+
+		void _attach_allocator(ft::false_type) { }
+
+		void _attach_allocator(ft::true_type) { this->_alloc.attach(this, &vector::_compact); }
+
+		/**
+		 * Shrinks the vector at 'self' to fit
+		 * @return Number of bytes released
+		 */
+		static std::size_t _compact(void *self)
+		{
+			vector *v = static_cast<vector *>(self);
+			const size_type old_capacity = v->_capacity;
+			v->shrink_to_fit();
+			return (old_capacity - v->_capacity) * sizeof(value_type);
+		}
+
 		/* Constructors */
 	public:
 		/* Default Constructor */
-		explicit vector(const allocator_type &alloc = allocator_type()) : _capacity(), _alloc(alloc), _content() { }
+		explicit vector(const allocator_type &alloc = allocator_type()) : _capacity(), _alloc(alloc), _content()
+		{
+			this->_attach_allocator();
+		}
 
 		/* Fill Constructor */
 		explicit vector(size_type n, const value_type &val = value_type(),
 						const allocator_type &alloc = allocator_type()) : _capacity(n), _alloc(alloc)
 		{
+			this->_attach_allocator();
 			this->_allocate_content(this->_capacity);
 			this->_fill_content(val);
 		}
@@ -120,21 +510,28 @@ namespace ft
 			   typename ft::enable_if<!ft::is_integral<InputIterator>::value, bool>::type = true) : _capacity(
 				size_type()), _alloc(alloc), _content()
 		{
-			if (this->_content.start != NULL && this->_content.end != NULL)
-				this->clear();
-			for (InputIterator iter = first; iter != last; ++iter)
-			{
-				this->push_back(*iter);
-			}
+			this->_attach_allocator();
+			this->_range_init(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 		}
 
 		/* Copy Constructor */
 		vector(const vector &x) : _capacity(x.capacity()), _alloc(x.get_allocator()), _content()
 		{
+			this->_attach_allocator();
 			this->_allocate_content(this->_capacity);
 			this->_fill_content(x);
 		}
 
+#if FT_CXX11
+		/* Move Constructor, takes over the buffer of 'x' and leaves it empty */
+		vector(vector &&x) noexcept : _capacity(x._capacity), _alloc(ft::move(x._alloc)), _content(x._content)
+		{
+			x._content.start = x._content.end = NULL;
+			x._capacity = 0;
+			this->_attach_allocator();
+		}
+#endif
+
 		/* Destructors */
 	public:
 		~vector()
@@ -158,6 +555,23 @@ namespace ft
 			return *this;
 		}
 
+#if FT_CXX11
+		/* The buffer of 'x' is taken over along with the allocator that owns it */
+		vector &operator=(vector &&x)
+		{
+			if (this == &x)
+				return *this;
+
+			this->_release_content(this->_content, this->_capacity);
+			this->_alloc = ft::move(x._alloc);
+			this->_content = x._content;
+			this->_capacity = x._capacity;
+			x._content.start = x._content.end = NULL;
+			x._capacity = 0;
+			return *this;
+		}
+#endif
+
 		/* Iterator functions */
 	public:
 		iterator begin() { return iterator(this->_content.start); }
@@ -178,7 +592,7 @@ namespace ft
 
 		/* Capacity functions */
 	public:
-		size_type size() const { return ft::distance(this->begin(), this->end()); }
+		size_type size() const { return static_cast<size_type>(this->_content.end - this->_content.start); }
 
 		size_type max_size() const
 		{
@@ -195,7 +609,7 @@ namespace ft
 				throw std::length_error("ft::vector::resize");
 			if (n < this->size())
 			{
-				_destroy(this->_content.start + n, this->_content.end);
+				ft::_destroy(this->_alloc, this->_content.start + n, this->_content.end);
 				this->_content.end = this->_content.start + n;
 				return;
 			}
@@ -210,6 +624,65 @@ namespace ft
 			this->_fill_content(val, this->size(), &n);
 		}
 
+		/**
+		 * Resizes to 'n' elements, default-initializing the new ones
+		 * @details Unlike 'resize', new elements of trivial types such as 'char' are not zeroed, so a buffer
+		 * can be grown right before being overwritten without paying for a fill pass
+		 */
+		void resize_default_init(size_type n)
+		{
+			if (n < this->size())
+			{
+				ft::_destroy(this->_alloc, this->_content.start + n, this->_content.end);
+				this->_content.end = this->_content.start + n;
+				return;
+			}
+			if (n > this->_capacity)
+				this->reserve(this->_recommend_capacity(n));
+			this->_content.end = this->_default_init(this->_content.end, n - this->size());
+		}
+
+		/**
+		 * Grows the vector by up to 'n' elements written in place by 'writer'
+		 * @details Calls 'writer(dest, n)' with 'dest' pointing to raw storage for 'n' elements past the end.
+		 * The writer stores its elements there, constructing them unless they are trivial, and returns how
+		 * many it wrote, at most 'n'. Only that many elements are appended, e.g. the count returned by 'read'.
+		 * @return Number of elements appended
+		 */
+		template < class Writer >
+		size_type append_with(size_type n, Writer writer)
+		{
+			if (n > this->_capacity - this->size())
+				this->reserve(this->_recommend_capacity(this->size() + n));
+			const size_type written = writer(this->_content.end, n);
+			this->_content.end += written;
+			return written;
+		}
+
+		/**
+		 * Sets the capacity to exactly 'n', or to the size if larger
+		 * @details Unlike 'reserve', also shrinks, and a capacity of zero releases the buffer
+		 */
+		void reserve_exact(size_type n)
+		{
+			n = ft::max(n, this->size());
+			if (n == this->_capacity)
+				return;
+			if (n > this->max_size())
+				throw std::length_error("ft::vector::reserve_exact");
+			if (n != 0)
+			{
+				this->_reallocate(n);
+				return;
+			}
+			this->_alloc.deallocate(this->_content.start, this->_capacity);
+			this->_content.start = this->_content.end = NULL;
+			this->_capacity = 0;
+		}
+
+		/* Releases the spare capacity, which 'clear', 'erase' and shrinking 'resize' keep */
+		void shrink_to_fit() { this->reserve_exact(this->size()); }
+
 		void reserve(size_type n)
 		{
 			if (n <= this->_capacity)
@@ -217,19 +690,7 @@ namespace ft
 			if (n > this->max_size())
 				throw std::length_error("ft::vector::reserve");
 
-			// copy old stuff
-			const size_type old_capacity = this->capacity();
-			const content old_content = { this->_content.start, this->_content.end };
-			// allocate new space
-			this->_allocate_content(n);
-			// copy old stuff into new space
-			this->_fill_content(iterator(old_content.start), iterator(old_content.end));
-			// destroy old stuff
-			_destroy(old_content.start, old_content.end);
-			if (old_content.start != NULL)
-				this->_alloc.deallocate(old_content.start, old_capacity);
-
-			this->_capacity = n;
+			this->_reallocate(n);
 		}
 
 		/* Element access functions */
@@ -266,16 +727,14 @@ namespace ft
 		void assign(InputIterator first, InputIterator last,
 					typename ft::enable_if<!ft::is_integral<InputIterator>::value, bool>::type = true)
 		{
-			this->clear();
-			for (InputIterator iter = first; iter != last; ++iter)
-				this->push_back(*iter);
+			this->_range_assign(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 		}
 
 		void assign(size_type n, const value_type &val)
 		{
 			const size_type new_size = n;
 
-			_destroy(this->_content.start, this->_content.end);
+			ft::_destroy(this->_alloc, this->_content.start, this->_content.end);
 			if (new_size > this->_capacity)
 			{
 				if (this->_content.start != NULL)
@@ -289,9 +748,54 @@ namespace ft
 
 		void push_back(const value_type &val)
 		{
-			this->resize(this->size() + 1, val);
+			if (this->_content.end != this->_content.start + this->_capacity)
+			{
+				this->_alloc.construct(this->_content.end, val);
+				++this->_content.end;
+				return;
+			}
+			this->_realloc_push_back(val);
 		}
 
+#if FT_CXX11
+		void push_back(value_type &&val) { this->emplace_back(ft::move(val)); }
+
+		template < class... Args >
+		void emplace_back(Args &&...args)
+		{
+			if (this->_content.end != this->_content.start + this->_capacity)
+			{
+				this->_alloc.construct(this->_content.end, ft::forward<Args>(args)...);
+				++this->_content.end;
+				return;
+			}
+			this->_realloc_emplace(this->size(), ft::forward<Args>(args)...);
+		}
+
+		/**
+		 * Constructs an element from 'args' before 'position'
+		 * @details Unless it goes at the end without reallocating, the element is first built as a
+		 * temporary, as 'args' may refer to elements about to be shifted
+		 * @return Iterator to the new element
+		 */
+		template < class... Args >
+		iterator emplace(iterator position, Args &&...args)
+		{
+			const size_type offset = position - this->begin();
+			if (this->_content.end == this->_content.start + this->_capacity)
+				this->_realloc_emplace(offset, ft::forward<Args>(args)...);
+			else if (offset == this->size())
+			{
+				this->_alloc.construct(this->_content.end, ft::forward<Args>(args)...);
+				++this->_content.end;
+			}
+			else
+				ft::_emplace_in_place(this->_alloc, this->_content.start + offset, this->_content.end,
+									  value_type(ft::forward<Args>(args)...));
+			return iterator(this->_content.start + offset);
+		}
+#endif
+
 		void pop_back()
 		{
 			--this->_content.end;
@@ -305,71 +809,54 @@ namespace ft
 			return iterator(this->_content.start + dist);
 		}
 
+#if FT_CXX11
+		iterator insert(iterator position, value_type &&val) { return this->emplace(position, ft::move(val)); }
+#endif
+
 		void insert(iterator position, size_type n, const value_type &val)
 		{
 			if (n == 0)
 				return;
 
-			const size_type old_cap = this->capacity();
-			const content old_content = { this->_content.start, this->_content.end };
-			iterator old_start = this->begin();
-			iterator old_end = this->end();
-			// reallocate to capacity + n
-			this->_allocate_content(old_cap + n);
-			// write old stuff to content until position - 1
-			this->_fill_content(old_start, position);
-			// write val n times
-			this->_fill_content(val, 0, &n);
-			// continue writing old stuff to content until cap
-			this->_fill_content(position, old_end);
-			// destroy old stuff
-			_destroy(old_content.start, old_content.end);
-			if (old_content.start != NULL)
-				this->_alloc.deallocate(old_content.start, old_cap);
+			const size_type offset = position - this->begin();
+			if (this->_capacity - this->size() >= n)
+			{
+				ft::_insert_fill_in_place(this->_alloc, this->_content.start + offset, this->_content.end, n, val);
+				return;
+			}
+			const size_type new_capacity = this->_recommend_capacity(this->size() + n);
+			pointer new_start = this->_alloc.allocate(new_capacity);
+			try
+			{
+				ft::_uninitialized_fill(this->_alloc, new_start + offset, n, val);
+			}
+			catch (...)
+			{
+				this->_alloc.deallocate(new_start, new_capacity);
+				throw;
+			}
+			// 'val' may live in the old buffer, which is only released once the copies are made
+			this->_adopt_buffer(new_start, new_capacity, offset, n);
 		}
 
 		template < class InputIterator >
 		void insert(iterator position, InputIterator first, InputIterator last,
 					typename ft::enable_if<!ft::is_integral<InputIterator>::value, bool>::type = true)
 		{
-			vector vc(first, last);
-			const size_type n = vc.size();
-
-			if (n == 0)
-				return;
-
-			const size_type old_cap = this->capacity();
-			const content old_content = { this->_content.start, this->_content.end };
-			iterator old_start = this->begin();
-			iterator old_end = this->end();
-			// reallocate to capacity + n
-			this->_allocate_content(old_cap + n);
-			// write old stuff to vector
-			this->_fill_content(old_start, position);
-			// write range to vector
-			this->_fill_content(vc);
-			// continue writing old stuff to content until cap
-			this->_fill_content(position, old_end);
-			// destroy old stuff
-			_destroy(old_content.start, old_content.end);
-			if (old_content.start != NULL)
-				this->_alloc.deallocate(old_content.start, old_cap);
+			this->_range_insert(position - this->begin(), first, last,
+								typename ft::iterator_traits<InputIterator>::iterator_category());
 		}
 
 		iterator erase(iterator position) { return erase(position, position + 1); }
 
 		iterator erase(iterator first, iterator last)
 		{
-			if (this->_content.start == NULL && this->_content.end == NULL)
+			/* Also covers an empty vector, and keeps 'first' from being moved onto itself */
+			if (first == last)
 				return first;
 
-			iterator last_elem_added = ft::copy(last, this->end(), first);
-			for (pointer p = this->_content.start + ft::distance(this->begin(), last_elem_added);
-				 p != this->_content.end; ++p)
-			{
-				this->_alloc.destroy(p);
-			}
-			this->_content.end -= ft::distance(first, last);
+			ft::_erase_range(this->_alloc, this->_content.start + (first - this->begin()),
+							 this->_content.start + (last - this->begin()), this->_content.end);
 			return first;
 		}
 
@@ -401,8 +888,39 @@ namespace ft
 		/* Allocator functions */
 	public:
 		allocator_type get_allocator() const { return this->_alloc; }
+
+		/* Friend Functions */
+	public:
+		template < class U, class A, class Predicate >
+		friend typename vector<U, A>::size_type erase_if(vector<U, A> &v, Predicate pred);
+
+		template < class U, class A >
+		friend typename vector<U, A>::size_type erase(vector<U, A> &v, const U &val);
 	};
 
+	/* Erasure */
+	/**
+	 * Removes the elements of 'v' satisfying 'pred'
+	 * @details Unlike a loop of 'erase' calls, which shifts the tail once per removed element, survivors are
+	 * compacted in a single pass, in runs moved bytewise for relocatable types
+	 * @return Number of elements removed
+	 */
+	template < class T, class Alloc, class Predicate >
+	typename vector<T, Alloc>::size_type erase_if(vector<T, Alloc> &v, Predicate pred)
+	{
+		return v._erase_if(pred);
+	}
+
+	/**
+	 * Removes the elements of 'v' equal to 'val'
+	 * @return Number of elements removed
+	 */
+	template < class T, class Alloc >
+	typename vector<T, Alloc>::size_type erase(vector<T, Alloc> &v, const T &val)
+	{
+		return v._erase_if(typename vector<T, Alloc>::_equals(val));
+	}
+
 	/* Relational Operators Overload */
 	template < class T, class Alloc >
 	bool operator==(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
@@ -433,3 +951,5 @@ namespace ft
 	void swap(vector<T, Alloc> &x, vector<T, Alloc> &y) { return x.swap(y); }
 
 } // namespace ft
+
+#include "vector_bool.hpp"
@@ -0,0 +1,1119 @@
+#pragma once
+
+#include <memory>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#include <limits>
+#include <algorithm>
+#include "vector.hpp"
+#include "iterator/iterator_traits.hpp"
+#include "iterator/reverse_iterator.hpp"
+#include "iterator/iterator_utils.hpp"
+#include "type_traits/type_traits.hpp"
+#include "algorithm/min.hpp"
+#include "algorithm/max.hpp"
+#include "utility/compiler.hpp"
+
+namespace ft
+{
+	/**
+	 * Bit-packed vector of booleans
+	 * @details Stores one bit per element in 64-bit words of 'word_type'. Elements are accessed through a proxy
+	 * 'reference' and the iterators walk bit positions. Bits past 'size()' are kept cleared, which lets
+	 * 'count', 'find_first', comparisons and the bitwise operators work a whole word at a time.
+	 */
+	template < class Alloc >
+	class vector<bool, Alloc>
+	{
+		/* Member Types */
+	public:
+		typedef bool value_type;
+		typedef Alloc allocator_type;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef unsigned long long word_type;
+		typedef bool const_reference;
+
+		class reference;
+
+		class iterator;
+
+		class const_iterator;
+
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+		static const size_type bits_per_word = sizeof(word_type) * CHAR_BIT;
+
+	private:
+		typedef typename allocator_type::template rebind<word_type>::other word_allocator_type;
+
+		/* Subclasses */
+	private:
+		/* Position of a bit as its word and its offset within that word */
+		struct bit_position
+		{
+			word_type *word;
+			size_type offset;
+
+			word_type mask() const { return word_type(1) << this->offset; }
+
+			void increment()
+			{
+				if (++this->offset == bits_per_word)
+				{
+					this->offset = 0;
+					++this->word;
+				}
+			}
+
+			void decrement()
+			{
+				if (this->offset-- == 0)
+				{
+					this->offset = bits_per_word - 1;
+					--this->word;
+				}
+			}
+
+			void advance(difference_type n)
+			{
+				difference_type bit = static_cast<difference_type>(this->offset) + n;
+				difference_type words = bit / static_cast<difference_type>(bits_per_word);
+				bit %= static_cast<difference_type>(bits_per_word);
+				if (bit < 0)
+				{
+					bit += bits_per_word;
+					--words;
+				}
+				this->word += words;
+				this->offset = static_cast<size_type>(bit);
+			}
+
+			difference_type distance(const bit_position &from) const
+			{
+				return (this->word - from.word) * static_cast<difference_type>(bits_per_word)
+					   + static_cast<difference_type>(this->offset) - static_cast<difference_type>(from.offset);
+			}
+
+			bool operator==(const bit_position &other) const
+			{
+				return this->word == other.word && this->offset == other.offset;
+			}
+
+			bool operator<(const bit_position &other) const
+			{
+				return this->word < other.word || (this->word == other.word && this->offset < other.offset);
+			}
+		};
+
+	public:
+		/* Proxy standing in for a single bit */
+		class reference
+		{
+			friend class vector;
+
+			friend class iterator;
+
+			/* Private Members */
+		private:
+			word_type *_word;
+			word_type _mask;
+
+			/* Constructors */
+		private:
+			reference(word_type *word, word_type mask) : _word(word), _mask(mask) { }
+
+		public:
+			operator bool() const { return (*this->_word & this->_mask) != 0; }
+
+			reference &operator=(bool x)
+			{
+				if (x)
+					*this->_word |= this->_mask;
+				else
+					*this->_word &= ~this->_mask;
+				return *this;
+			}
+
+			reference &operator=(const reference &x) { return *this = static_cast<bool>(x); }
+
+			bool operator~() const { return !static_cast<bool>(*this); }
+
+			void flip() { *this->_word ^= this->_mask; }
+		};
+
+		/* Iterator Subclasses */
+	public:
+		class iterator
+		{
+			friend class vector;
+
+			friend class const_iterator;
+
+			/* Iterator Tags */
+		public:
+			typedef ft::random_access_iterator_tag iterator_category;
+			typedef bool value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef typename vector::reference reference;
+			typedef void pointer;
+
+			/* Private Members */
+		private:
+			bit_position _pos;
+
+			/* Constructors */
+		private:
+			iterator(word_type *word, size_type offset)
+			{
+				this->_pos.word = word;
+				this->_pos.offset = offset;
+			}
+
+		public:
+			iterator()
+			{
+				this->_pos.word = NULL;
+				this->_pos.offset = 0;
+			}
+
+			/* Dereference Operators */
+		public:
+			reference operator*() const { return reference(this->_pos.word, this->_pos.mask()); }
+
+			reference operator[](difference_type n) const { return *(*this + n); }
+
+			/* Arithmetic Operators */
+		public:
+			iterator &operator++()
+			{
+				this->_pos.increment();
+				return *this;
+			}
+
+			iterator operator++(int)
+			{
+				iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			iterator &operator--()
+			{
+				this->_pos.decrement();
+				return *this;
+			}
+
+			iterator operator--(int)
+			{
+				iterator tmp = *this;
+				--(*this);
+				return tmp;
+			}
+
+			iterator &operator+=(difference_type n)
+			{
+				this->_pos.advance(n);
+				return *this;
+			}
+
+			iterator &operator-=(difference_type n)
+			{
+				this->_pos.advance(-n);
+				return *this;
+			}
+
+			iterator operator+(difference_type n) const
+			{
+				iterator tmp = *this;
+				return tmp += n;
+			}
+
+			iterator operator-(difference_type n) const
+			{
+				iterator tmp = *this;
+				return tmp -= n;
+			}
+
+			difference_type operator-(const iterator &other) const { return this->_pos.distance(other._pos); }
+
+			friend iterator operator+(difference_type n, const iterator &it) { return it + n; }
+
+			/* Relational Operators */
+		public:
+			friend bool operator==(const iterator &lhs, const iterator &rhs) { return lhs._pos == rhs._pos; }
+
+			friend bool operator!=(const iterator &lhs, const iterator &rhs) { return !(lhs._pos == rhs._pos); }
+
+			friend bool operator<(const iterator &lhs, const iterator &rhs) { return lhs._pos < rhs._pos; }
+
+			friend bool operator>(const iterator &lhs, const iterator &rhs) { return rhs._pos < lhs._pos; }
+
+			friend bool operator<=(const iterator &lhs, const iterator &rhs) { return !(rhs._pos < lhs._pos); }
+
+			friend bool operator>=(const iterator &lhs, const iterator &rhs) { return !(lhs._pos < rhs._pos); }
+		};
+
+		class const_iterator
+		{
+			friend class vector;
+
+			/* Iterator Tags */
+		public:
+			typedef ft::random_access_iterator_tag iterator_category;
+			typedef bool value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef bool reference;
+			typedef void pointer;
+
+			/* Private Members */
+		private:
+			bit_position _pos;
+
+			/* Constructors */
+		private:
+			const_iterator(const word_type *word, size_type offset)
+			{
+				this->_pos.word = const_cast<word_type *>(word);
+				this->_pos.offset = offset;
+			}
+
+		public:
+			const_iterator()
+			{
+				this->_pos.word = NULL;
+				this->_pos.offset = 0;
+			}
+
+			const_iterator(const iterator &it) : _pos(it._pos) { }
+
+			/* Dereference Operators */
+		public:
+			bool operator*() const { return (*this->_pos.word & this->_pos.mask()) != 0; }
+
+			bool operator[](difference_type n) const { return *(*this + n); }
+
+			/* Arithmetic Operators */
+		public:
+			const_iterator &operator++()
+			{
+				this->_pos.increment();
+				return *this;
+			}
+
+			const_iterator operator++(int)
+			{
+				const_iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			const_iterator &operator--()
+			{
+				this->_pos.decrement();
+				return *this;
+			}
+
+			const_iterator operator--(int)
+			{
+				const_iterator tmp = *this;
+				--(*this);
+				return tmp;
+			}
+
+			const_iterator &operator+=(difference_type n)
+			{
+				this->_pos.advance(n);
+				return *this;
+			}
+
+			const_iterator &operator-=(difference_type n)
+			{
+				this->_pos.advance(-n);
+				return *this;
+			}
+
+			const_iterator operator+(difference_type n) const
+			{
+				const_iterator tmp = *this;
+				return tmp += n;
+			}
+
+			const_iterator operator-(difference_type n) const
+			{
+				const_iterator tmp = *this;
+				return tmp -= n;
+			}
+
+			difference_type operator-(const const_iterator &other) const { return this->_pos.distance(other._pos); }
+
+			friend const_iterator operator+(difference_type n, const const_iterator &it) { return it + n; }
+
+			/* Relational Operators */
+		public:
+			friend bool operator==(const const_iterator &lhs, const const_iterator &rhs)
+			{
+				return lhs._pos == rhs._pos;
+			}
+
+			friend bool operator!=(const const_iterator &lhs, const const_iterator &rhs)
+			{
+				return !(lhs._pos == rhs._pos);
+			}
+
+			friend bool operator<(const const_iterator &lhs, const const_iterator &rhs)
+			{
+				return lhs._pos < rhs._pos;
+			}
+
+			friend bool operator>(const const_iterator &lhs, const const_iterator &rhs)
+			{
+				return rhs._pos < lhs._pos;
+			}
+
+			friend bool operator<=(const const_iterator &lhs, const const_iterator &rhs)
+			{
+				return !(rhs._pos < lhs._pos);
+			}
+
+			friend bool operator>=(const const_iterator &lhs, const const_iterator &rhs)
+			{
+				return !(lhs._pos < rhs._pos);
+			}
+		};
+
+		/* Private Members */
+	private:
+		word_allocator_type _alloc;
+		word_type *_words;
+		size_type _size;
+		size_type _nb_words;
+
+		/* Private Functions */
+	private:
+		static size_type _words_for(size_type n) { return (n + bits_per_word - 1) / bits_per_word; }
+
+		static size_type _popcount(word_type w)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_popcountll(w);
+#else
+			size_type n = 0;
+			for (; w != 0; w &= w - 1)
+				++n;
+			return n;
+#endif
+		}
+
+		/* Index of the lowest set bit of a non-zero word */
+		static size_type _count_trailing_zeros(word_type w)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_ctzll(w);
+#else
+			size_type n = 0;
+			for (; (w & 1) == 0; w >>= 1)
+				++n;
+			return n;
+#endif
+		}
+
+		bool _get(size_type i) const { return (this->_words[ i / bits_per_word ] >> (i % bits_per_word)) & 1; }
+
+		void _set(size_type i, bool val)
+		{
+			const word_type mask = word_type(1) << (i % bits_per_word);
+			if (val)
+				this->_words[ i / bits_per_word ] |= mask;
+			else
+				this->_words[ i / bits_per_word ] &= ~mask;
+		}
+
+		void _apply_mask(size_type w, word_type mask, bool val)
+		{
+			if (val)
+				this->_words[ w ] |= mask;
+			else
+				this->_words[ w ] &= ~mask;
+		}
+
+		/**
+		 * Sets the bits [first, last) to 'val'
+		 * @details Only the partial words at both ends are masked, whole words in between are stored at once
+		 */
+		void _fill_bits(size_type first, size_type last, bool val)
+		{
+			if (first >= last)
+				return;
+			const size_type first_word = first / bits_per_word;
+			const size_type last_word = (last - 1) / bits_per_word;
+			const word_type first_mask = ~word_type(0) << (first % bits_per_word);
+			const word_type last_mask = ~word_type(0) >> (bits_per_word - 1 - (last - 1) % bits_per_word);
+			if (first_word == last_word)
+			{
+				this->_apply_mask(first_word, first_mask & last_mask, val);
+				return;
+			}
+			this->_apply_mask(first_word, first_mask, val);
+			const word_type whole = val ? ~word_type(0) : word_type(0);
+			for (size_type w = first_word + 1; w < last_word; ++w)
+				this->_words[ w ] = whole;
+			this->_apply_mask(last_word, last_mask, val);
+		}
+
+		/* Mask of the 'n' low bits, 'n' being at most 'bits_per_word' */
+		static word_type _low_mask(size_type n) { return n == bits_per_word ? ~word_type(0) : (word_type(1) << n) - 1; }
+
+		/* The 'n' bits from 'i' on, at most a word of them, funnel shifted from the one or two words holding them */
+		word_type _read_bits(size_type i, size_type n) const
+		{
+			const size_type w = i / bits_per_word;
+			const size_type offset = i % bits_per_word;
+			word_type bits = this->_words[ w ] >> offset;
+			if (offset + n > bits_per_word)
+				bits |= this->_words[ w + 1 ] << (bits_per_word - offset);
+			return bits & _low_mask(n);
+		}
+
+		/* Stores the 'n' low bits of 'bits' from 'i' on, at most a word of them */
+		void _write_bits(size_type i, word_type bits, size_type n)
+		{
+			const size_type w = i / bits_per_word;
+			const size_type offset = i % bits_per_word;
+			const word_type mask = _low_mask(n);
+			this->_words[ w ] = (this->_words[ w ] & ~(mask << offset)) | (bits << offset);
+			if (offset + n > bits_per_word)
+			{
+				const size_type spill = bits_per_word - offset;
+				this->_words[ w + 1 ] = (this->_words[ w + 1 ] & ~(mask >> spill)) | (bits >> spill);
+			}
+		}
+
+		/**
+		 * Moves the bits [first, last) to start at 'dest'
+		 * @details Goes a word at a time, away from the side the ranges overlap on, so that every word is read
+		 * before it is overwritten
+		 */
+		void _move_bits(size_type first, size_type last, size_type dest)
+		{
+			const size_type n = last - first;
+			if (dest < first)
+			{
+				for (size_type done = 0; done < n; done += bits_per_word)
+				{
+					const size_type chunk = ft::min<size_type>(bits_per_word, n - done);
+					this->_write_bits(dest + done, this->_read_bits(first + done, chunk), chunk);
+				}
+			}
+			else if (dest > first)
+			{
+				for (size_type left = n; left != 0;)
+				{
+					const size_type chunk = ft::min<size_type>(bits_per_word, left);
+					left -= chunk;
+					this->_write_bits(dest + left, this->_read_bits(first + left, chunk), chunk);
+				}
+			}
+		}
+
+		/* Replaces the buffer by a zeroed one of 'nb_words' words holding the current bits */
+		void _reallocate(size_type nb_words)
+		{
+			word_type *words = this->_alloc.allocate(nb_words);
+			const size_type used = _words_for(this->_size);
+			if (used != 0)
+				std::memcpy(words, this->_words, used * sizeof(word_type));
+			std::memset(words + used, 0, (nb_words - used) * sizeof(word_type));
+			if (this->_words != NULL)
+				this->_alloc.deallocate(this->_words, this->_nb_words);
+			this->_words = words;
+			this->_nb_words = nb_words;
+		}
+
+		/* Makes room for 'n' bits, growing geometrically */
+		void _grow_to(size_type n)
+		{
+			if (n <= this->capacity())
+				return;
+			if (n > this->max_size())
+				throw std::length_error("ft::vector<bool>");
+			this->_reallocate(ft::max<size_type>(this->_nb_words * 2, _words_for(n)));
+		}
+
+		/* Registers the vector with its allocator, if it is compactable, so that it can be shrunk from outside */
+		void _attach_allocator()
+		{
+			this->_attach_allocator(ft::allocator_is_compactable<word_allocator_type>());
+		}
+
+		void _attach_allocator(ft::false_type) { }
+
+		void _attach_allocator(ft::true_type) { this->_alloc.attach(this, &vector::_compact); }
+
+		/**
+		 * Shrinks the vector at 'self' to fit
+		 * @return Number of bytes released
+		 */
+		static std::size_t _compact(void *self)
+		{
+			vector *v = static_cast<vector *>(self);
+			const size_type old_nb_words = v->_nb_words;
+			v->shrink_to_fit();
+			return (old_nb_words - v->_nb_words) * sizeof(word_type);
+		}
+
+		/* Index of the first set bit at or after 'i', or 'size()' */
+		size_type _find_from(size_type i) const
+		{
+			if (i >= this->_size)
+				return this->_size;
+			size_type w = i / bits_per_word;
+			word_type bits = this->_words[ w ] & (~word_type(0) << (i % bits_per_word));
+			const size_type used = _words_for(this->_size);
+			while (bits == 0)
+			{
+				if (++w == used)
+					return this->_size;
+				bits = this->_words[ w ];
+			}
+			return w * bits_per_word + _count_trailing_zeros(bits);
+		}
+
+		void _check_same_size(const vector &x, const char *what) const
+		{
+			if (this->_size != x._size)
+				throw std::invalid_argument(what);
+		}
+
+		/**
+		 * Removes the bits satisfying 'pred' in a single pass
+		 * @details Survivors are gathered into a word written out once full. If 'pred' throws, the pending
+		 * survivors are stored and the bits not tested yet moved down behind them, so that none is lost.
+		 * @return Number of bits removed
+		 */
+		template < class Predicate >
+		size_type _erase_if(Predicate pred)
+		{
+			const size_type old_size = this->_size;
+			if (old_size == 0)
+				return 0;
+			size_type dest = 0;
+			size_type i = 0;
+			word_type gathered = 0;
+			try
+			{
+				for (; i < old_size; ++i)
+				{
+					const bool bit = this->_get(i);
+					if (pred(bit))
+						continue;
+					gathered |= word_type(bit) << (dest % bits_per_word);
+					if (++dest % bits_per_word == 0)
+					{
+						this->_words[ dest / bits_per_word - 1 ] = gathered;
+						gathered = 0;
+					}
+				}
+			}
+			catch (...)
+			{
+				this->_write_bits(dest - dest % bits_per_word, gathered, dest % bits_per_word);
+				this->_move_bits(i, old_size, dest);
+				this->_size = dest + (old_size - i);
+				this->_fill_bits(this->_size, old_size, false);
+				throw;
+			}
+			if (dest % bits_per_word != 0)
+				this->_words[ dest / bits_per_word ] = gathered;
+			this->_size = dest;
+			const size_type used = _words_for(dest);
+			std::memset(this->_words + used, 0, (_words_for(old_size) - used) * sizeof(word_type));
+			return old_size - dest;
+		}
+
+		/* Predicate of 'ft::erase' */
+		struct _equals
+		{
+			const bool val;
+
+			explicit _equals(bool x) : val(x) { }
+
+			bool operator()(bool x) const { return x == this->val; }
+		};
+
+		template < class InputIterator >
+		void _range_assign(InputIterator first, InputIterator last, ft::input_iterator_tag)
+		{
+			this->clear();
+			for (; first != last; ++first)
+				this->push_back(*first);
+		}
+
+		template < class ForwardIterator >
+		void _range_assign(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+		{
+			const size_type n = ft::distance(first, last);
+			this->clear();
+			if (n > this->capacity())
+			{
+				if (n > this->max_size())
+					throw std::length_error("ft::vector<bool>::assign");
+				this->_reallocate(_words_for(n));
+			}
+			for (size_type i = 0; first != last; ++first, ++i)
+				if (*first)
+					this->_set(i, true);
+			this->_size = n;
+		}
+
+		template < class InputIterator >
+		void _range_insert(size_type offset, InputIterator first, InputIterator last, ft::input_iterator_tag)
+		{
+			vector vc(first, last);
+			this->_range_insert(offset, vc.begin(), vc.end(), ft::forward_iterator_tag());
+		}
+
+		template < class ForwardIterator >
+		void _range_insert(size_type offset, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+		{
+			const size_type n = ft::distance(first, last);
+			if (n == 0)
+				return;
+			this->_grow_to(this->_size + n);
+			this->_move_bits(offset, this->_size, offset + n);
+			for (size_type i = offset; first != last; ++first, ++i)
+				this->_set(i, *first);
+			this->_size += n;
+		}
+
+		/* Constructors */
+	public:
+		/* Default Constructor */
+		explicit vector(const allocator_type &alloc = allocator_type())
+				: _alloc(alloc), _words(NULL), _size(0), _nb_words(0)
+		{
+			this->_attach_allocator();
+		}
+
+		/* Fill Constructor */
+		explicit vector(size_type n, const value_type &val = value_type(),
+						const allocator_type &alloc = allocator_type())
+				: _alloc(alloc), _words(NULL), _size(0), _nb_words(0)
+		{
+			this->_attach_allocator();
+			this->assign(n, val);
+		}
+
+		/* Range Constructor */
+		template < class InputIterator >
+		vector(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type(),
+			   typename ft::enable_if<!ft::is_integral<InputIterator>::value, bool>::type = true)
+				: _alloc(alloc), _words(NULL), _size(0), _nb_words(0)
+		{
+			this->_attach_allocator();
+			try
+			{
+				this->assign(first, last);
+			}
+			catch (...)
+			{
+				if (this->_words != NULL)
+					this->_alloc.deallocate(this->_words, this->_nb_words);
+				throw;
+			}
+		}
+
+		/* Copy Constructor */
+		vector(const vector &x) : _alloc(x._alloc), _words(NULL), _size(0), _nb_words(0)
+		{
+			this->_attach_allocator();
+			const size_type used = _words_for(x._size);
+			if (used == 0)
+				return;
+			this->_words = this->_alloc.allocate(used);
+			this->_nb_words = used;
+			std::memcpy(this->_words, x._words, used * sizeof(word_type));
+			this->_size = x._size;
+		}
+
+#if FT_CXX11
+		/* Move Constructor, takes over the words of 'x' and leaves it empty */
+		vector(vector &&x) noexcept : _alloc(x._alloc), _words(x._words), _size(x._size), _nb_words(x._nb_words)
+		{
+			x._words = NULL;
+			x._size = 0;
+			x._nb_words = 0;
+			this->_attach_allocator();
+		}
+#endif
+
+		/* Destructors */
+	public:
+		~vector()
+		{
+			if (this->_words != NULL)
+				this->_alloc.deallocate(this->_words, this->_nb_words);
+		}
+
+		/* Public Member Functions */
+	public:
+		vector &operator=(const vector &x)
+		{
+			if (this == &x)
+				return *this;
+
+			const size_type used = _words_for(x._size);
+			const size_type old_used = _words_for(this->_size);
+			if (used > this->_nb_words)
+			{
+				this->_size = 0;
+				this->_reallocate(used);
+			}
+			if (used != 0)
+				std::memcpy(this->_words, x._words, used * sizeof(word_type));
+			if (old_used > used)
+				std::memset(this->_words + used, 0, (old_used - used) * sizeof(word_type));
+			this->_size = x._size;
+			return *this;
+		}
+
+#if FT_CXX11
+		vector &operator=(vector &&x)
+		{
+			if (this == &x)
+				return *this;
+
+			if (this->_words != NULL)
+				this->_alloc.deallocate(this->_words, this->_nb_words);
+			this->_alloc = x._alloc;
+			this->_words = x._words;
+			this->_size = x._size;
+			this->_nb_words = x._nb_words;
+			x._words = NULL;
+			x._size = 0;
+			x._nb_words = 0;
+			return *this;
+		}
+#endif
+
+		/* Iterator functions */
+	public:
+		iterator begin() { return iterator(this->_words, 0); }
+
+		const_iterator begin() const { return const_iterator(this->_words, 0); }
+
+		iterator end()
+		{
+			return iterator(this->_words + this->_size / bits_per_word, this->_size % bits_per_word);
+		}
+
+		const_iterator end() const
+		{
+			return const_iterator(this->_words + this->_size / bits_per_word, this->_size % bits_per_word);
+		}
+
+		reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+
+		const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+
+		reverse_iterator rend() { return reverse_iterator(this->begin()); }
+
+		const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+
+		/* Capacity functions */
+	public:
+		size_type size() const { return this->_size; }
+
+		size_type max_size() const
+		{
+			return ft::min<size_type>(this->_alloc.max_size(),
+									  std::numeric_limits<difference_type>::max() / bits_per_word) * bits_per_word;
+		}
+
+		size_type capacity() const { return this->_nb_words * bits_per_word; }
+
+		bool empty() const { return this->_size == 0; }
+
+		void resize(size_type n, value_type val = value_type())
+		{
+			if (n < this->_size)
+			{
+				this->_fill_bits(n, this->_size, false);
+				this->_size = n;
+				return;
+			}
+			this->_grow_to(n);
+			if (val)
+				this->_fill_bits(this->_size, n, true);
+			this->_size = n;
+		}
+
+		void reserve(size_type n)
+		{
+			if (n <= this->capacity())
+				return;
+			if (n > this->max_size())
+				throw std::length_error("ft::vector<bool>::reserve");
+			this->_reallocate(_words_for(n));
+		}
+
+		/**
+		 * Sets the capacity to exactly the words holding 'n' bits, or the size if larger
+		 * @details Unlike 'reserve', also shrinks, and a capacity of zero releases the words
+		 */
+		void reserve_exact(size_type n)
+		{
+			n = ft::max(n, this->_size);
+			if (n > this->max_size())
+				throw std::length_error("ft::vector<bool>::reserve_exact");
+			const size_type nb_words = _words_for(n);
+			if (nb_words == this->_nb_words)
+				return;
+			if (nb_words != 0)
+			{
+				this->_reallocate(nb_words);
+				return;
+			}
+			this->_alloc.deallocate(this->_words, this->_nb_words);
+			this->_words = NULL;
+			this->_nb_words = 0;
+		}
+
+		/* Releases the spare words, which 'clear', 'erase' and shrinking 'resize' keep */
+		void shrink_to_fit() { this->reserve_exact(this->_size); }
+
+		/* Element access functions */
+	public:
+		reference operator[](size_type n)
+		{
+			return reference(this->_words + n / bits_per_word, word_type(1) << (n % bits_per_word));
+		}
+
+		const_reference operator[](size_type n) const { return this->_get(n); }
+
+		reference at(size_type n)
+		{
+			if (n >= this->_size)
+				throw std::out_of_range("ft::vector<bool>::at");
+			return (*this)[ n ];
+		}
+
+		const_reference at(size_type n) const
+		{
+			if (n >= this->_size)
+				throw std::out_of_range("ft::vector<bool>::at");
+			return this->_get(n);
+		}
+
+		reference front() { return (*this)[ 0 ]; }
+
+		const_reference front() const { return this->_get(0); }
+
+		reference back() { return (*this)[ this->_size - 1 ]; }
+
+		const_reference back() const { return this->_get(this->_size - 1); }
+
+		/* Bit Operation functions */
+	public:
+		/* Number of set bits */
+		size_type count() const
+		{
+			size_type n = 0;
+			const size_type used = _words_for(this->_size);
+			for (size_type w = 0; w < used; ++w)
+				n += _popcount(this->_words[ w ]);
+			return n;
+		}
+
+		/* Index of the first set bit, or 'size()' if there is none */
+		size_type find_first() const { return this->_find_from(0); }
+
+		/* Index of the first set bit after 'prev', or 'size()' if there is none */
+		size_type find_next(size_type prev) const { return this->_find_from(prev + 1); }
+
+		void flip()
+		{
+			const size_type used = _words_for(this->_size);
+			for (size_type w = 0; w < used; ++w)
+				this->_words[ w ] = ~this->_words[ w ];
+			if (this->_size % bits_per_word != 0)
+				this->_words[ used - 1 ] &= ~(~word_type(0) << (this->_size % bits_per_word));
+		}
+
+		/* The bitwise operators require both vectors to have the same size */
+		vector &operator&=(const vector &x)
+		{
+			this->_check_same_size(x, "ft::vector<bool>::operator&=");
+			const size_type used = _words_for(this->_size);
+			for (size_type w = 0; w < used; ++w)
+				this->_words[ w ] &= x._words[ w ];
+			return *this;
+		}
+
+		vector &operator|=(const vector &x)
+		{
+			this->_check_same_size(x, "ft::vector<bool>::operator|=");
+			const size_type used = _words_for(this->_size);
+			for (size_type w = 0; w < used; ++w)
+				this->_words[ w ] |= x._words[ w ];
+			return *this;
+		}
+
+		vector &operator^=(const vector &x)
+		{
+			this->_check_same_size(x, "ft::vector<bool>::operator^=");
+			const size_type used = _words_for(this->_size);
+			for (size_type w = 0; w < used; ++w)
+				this->_words[ w ] ^= x._words[ w ];
+			return *this;
+		}
+
+		/* Modifiers functions */
+	public:
+		template < class InputIterator >
+		void assign(InputIterator first, InputIterator last,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, bool>::type = true)
+		{
+			this->_range_assign(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		void assign(size_type n, const value_type &val)
+		{
+			this->clear();
+			this->resize(n, val);
+		}
+
+		void push_back(const value_type &val)
+		{
+			if (this->_size == this->capacity())
+				this->_grow_to(this->_size + 1);
+			if (val)
+				this->_set(this->_size, true);
+			++this->_size;
+		}
+
+		void pop_back()
+		{
+			--this->_size;
+			this->_set(this->_size, false);
+		}
+
+		iterator insert(iterator position, const value_type &val)
+		{
+			const size_type offset = position - this->begin();
+			this->insert(position, 1, val);
+			return this->begin() + offset;
+		}
+
+		void insert(iterator position, size_type n, const value_type &val)
+		{
+			if (n == 0)
+				return;
+			const size_type offset = position - this->begin();
+			this->_grow_to(this->_size + n);
+			this->_move_bits(offset, this->_size, offset + n);
+			this->_fill_bits(offset, offset + n, val);
+			this->_size += n;
+		}
+
+		template < class InputIterator >
+		void insert(iterator position, InputIterator first, InputIterator last,
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, bool>::type = true)
+		{
+			this->_range_insert(position - this->begin(), first, last,
+								typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		iterator erase(iterator position) { return erase(position, position + 1); }
+
+		iterator erase(iterator first, iterator last)
+		{
+			const size_type offset = first - this->begin();
+			const size_type n = last - first;
+			this->_move_bits(offset + n, this->_size, offset);
+			this->_fill_bits(this->_size - n, this->_size, false);
+			this->_size -= n;
+			return this->begin() + offset;
+		}
+
+		void swap(vector &x)
+		{
+			std::swap(this->_words, x._words);
+			std::swap(this->_size, x._size);
+			std::swap(this->_nb_words, x._nb_words);
+		}
+
+		static void swap(reference x, reference y)
+		{
+			const bool tmp = x;
+			x = y;
+			y = tmp;
+		}
+
+		void clear()
+		{
+			if (this->_size != 0)
+				std::memset(this->_words, 0, _words_for(this->_size) * sizeof(word_type));
+			this->_size = 0;
+		}
+
+		/* Allocator functions */
+	public:
+		allocator_type get_allocator() const { return allocator_type(this->_alloc); }
+
+		/* Friend declarations */
+	public:
+		template < class A >
+		friend bool operator==(const vector<bool, A> &lhs, const vector<bool, A> &rhs);
+
+		template < class U, class A, class Predicate >
+		friend typename vector<U, A>::size_type erase_if(vector<U, A> &v, Predicate pred);
+
+		template < class U, class A >
+		friend typename vector<U, A>::size_type erase(vector<U, A> &v, const U &val);
+	};
+
+	template < class Alloc >
+	const typename vector<bool, Alloc>::size_type vector<bool, Alloc>::bits_per_word;
+
+	/* Compares whole words, which works as the bits past the size are always cleared */
+	template < class Alloc >
+	bool operator==(const vector<bool, Alloc> &lhs, const vector<bool, Alloc> &rhs)
+	{
+		if (lhs._size != rhs._size)
+			return false;
+		const typename vector<bool, Alloc>::size_type used = vector<bool, Alloc>::_words_for(lhs._size);
+		for (typename vector<bool, Alloc>::size_type w = 0; w < used; ++w)
+			if (lhs._words[ w ] != rhs._words[ w ])
+				return false;
+		return true;
+	}
+
+	/* Whole vector bitwise operators, both operands must have the same size */
+	template < class Alloc >
+	vector<bool, Alloc> operator&(const vector<bool, Alloc> &lhs, const vector<bool, Alloc> &rhs)
+	{
+		vector<bool, Alloc> result(lhs);
+		result &= rhs;
+		return result;
+	}
+
+	template < class Alloc >
+	vector<bool, Alloc> operator|(const vector<bool, Alloc> &lhs, const vector<bool, Alloc> &rhs)
+	{
+		vector<bool, Alloc> result(lhs);
+		result |= rhs;
+		return result;
+	}
+
+	template < class Alloc >
+	vector<bool, Alloc> operator^(const vector<bool, Alloc> &lhs, const vector<bool, Alloc> &rhs)
+	{
+		vector<bool, Alloc> result(lhs);
+		result ^= rhs;
+		return result;
+	}
+
+} // namespace ft